@@ -133,6 +133,18 @@ void bench_performance() {
     auto [d_sum, r_sum] = fair_compare(daxe_sum, raw_sum);
     print_result("sum(container)", d_sum, r_sum);
     
+    // minmax
+    auto daxe_minmax = [&]() { return minmax(data); };
+    auto raw_minmax = [&]() { auto [lo, hi] = std::minmax_element(data.begin(), data.end()); return *hi - *lo; };
+    auto [d_minmax, r_minmax] = fair_compare(daxe_minmax, raw_minmax);
+    print_result("minmax(container)", d_minmax, r_minmax);
+    
+    // argmax
+    auto daxe_argmax = [&]() { return argmax(data); };
+    auto raw_argmax = [&]() { return std::max_element(data.begin(), data.end()) - data.begin(); };
+    auto [d_argmax, r_argmax] = fair_compare(daxe_argmax, raw_argmax);
+    print_result("argmax(container)", d_argmax, r_argmax);
+    
     // has (search for a value known to exist at middle)
     i64 search_val = data[N/2];
     auto daxe_has = [&]() { return has(data, search_val); };
@@ -219,9 +231,9 @@ void bench_safety() {
     // Negative indexing
     std::cout << "\n--- Negative Indexing Tests ---\n";
     vi64 v = {10, 20, 30, 40, 50};
-    print_test("getat(v, -1) = 50", valueor(getat(v, -1), 0LL) == 50);
-    print_test("getat(v, -2) = 40", valueor(getat(v, -2), 0LL) == 40);
-    print_test("getat(v, -5) = 10", valueor(getat(v, -5), 0LL) == 10);
+    print_test("getat(v, -1) = 50", valueor(getat(v, -1), i64{0}) == 50);
+    print_test("getat(v, -2) = 40", valueor(getat(v, -2), i64{0}) == 40);
+    print_test("getat(v, -5) = 10", valueor(getat(v, -5), i64{0}) == 10);
     print_test("getat(v, -6) returns None", isnone(getat(v, -6)));
     
     // Out of bounds
@@ -258,7 +270,7 @@ void bench_safety() {
     print_test("issome(Some(42))", issome(some));
     print_test("isnone(None)", isnone(none));
     print_test("unwrap(Some(42)) = 42", unwrap(some) == 42);
-    print_test("valueor(None, 99) = 99", valueor(none, 99LL) == 99);
+    print_test("valueor(None, 99) = 99", valueor(none, i64{99}) == 99);
     
     // Slice edge cases
     std::cout << "\n--- Slice Edge Cases ---\n";
@@ -480,7 +492,7 @@ int main() {
     
     // 3. Time (manual check mostly, just ensure it compiles and runs)
     f64 t_start = now();
-    sleep(1);
+    dax::sleep(1);
     f64 t_end = now();
     print_test("sleep(1ms) duration > 0", (t_end - t_start) > 0);
     
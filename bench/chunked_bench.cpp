@@ -0,0 +1,50 @@
+#include <daxe.h>
+#include <daxe/compat.h>
+#include <chrono>
+#include <random>
+
+using namespace dax;
+
+template<typename Func>
+f64 benchmark(const str& name, i64 iterations, Func&& f) {
+    auto start = std::chrono::high_resolution_clock::now();
+    for (i64 i = 0; i < iterations; ++i) {
+        f();
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+    f64 ms = std::chrono::duration<f64, std::milli>(end - start).count() / iterations;
+    println(name, ":", ms, "ms");
+    return ms;
+}
+
+// n elements, then `edits` random insertat/removeat pairs plus an index read each
+template <typename L>
+f64 run(const str& name, i64 n, i64 edits) {
+    return benchmark(name, 1, [&]() {
+        std::mt19937_64 gen(7);
+        L l;
+        for (i64 i = 0; i < n; ++i) l.append(i);
+        i64 acc = 0;
+        for (i64 e = 0; e < edits; ++e) {
+            const i64 size = static_cast<i64>(l.size());
+            l.insertat(static_cast<i64>(gen() % static_cast<u64>(size + 1)), e);
+            l.removeat(static_cast<i64>(gen() % static_cast<u64>(size + 1)));
+            acc += l[static_cast<size_t>(gen() % static_cast<u64>(size))];
+        }
+        volatile i64 r = acc;
+        (void)r;
+    });
+}
+
+int main() {
+    println("=== Chunked List Benchmark ===\n");
+
+    for (auto [n, edits] : {pi64{10000, 1000000}, pi64{1000000, 20000}}) {
+        println("---", edits, "random insert/erase/index on", n, "elements ---");
+        f64 flat = run<List<i64>>("List", n, edits);
+        f64 chunked = run<ChunkedList<i64>>("ChunkedList", n, edits);
+        println("Speedup:", flat / chunked, "x\n");
+    }
+
+    return 0;
+}
@@ -0,0 +1,53 @@
+#include <daxe.h>
+#include <daxe/compat.h>
+#include <chrono>
+#include <random>
+#include <unordered_map>
+
+using namespace dax;
+
+template<typename Func>
+f64 benchmark(const str& name, i64 iterations, Func&& f) {
+    auto start = std::chrono::high_resolution_clock::now();
+    for (i64 i = 0; i < iterations; ++i) {
+        f();
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+    f64 ms = std::chrono::duration<f64, std::milli>(end - start).count() / iterations;
+    println(name, ":", ms, "ms");
+    return ms;
+}
+
+// Insert every key (counting repeats), then look up hits and misses
+template <typename Map>
+f64 run(const str& name, const vu64& keys, const vu64& misses) {
+    return benchmark(name, 3, [&]() {
+        Map m;
+        for (u64 k : keys) ++m[k];
+        i64 acc = 0;
+        for (u64 k : keys) acc += m.count(k);
+        for (u64 k : misses) acc += m.count(k);
+        volatile i64 r = acc;
+        (void)r;
+    });
+}
+
+int main() {
+    println("=== Hash Dict Benchmark ===\n");
+
+    std::mt19937_64 gen(42);
+
+    for (i64 n : {1LL << 10, 1LL << 16, 1LL << 20}) {
+        vu64 keys(1 << 20), misses(1 << 20);
+        for (auto& x : keys) x = gen() % static_cast<u64>(n) * 2;
+        for (auto& x : misses) x = gen() % static_cast<u64>(n) * 2 + 1;
+
+        println("--- 1M inserts + 2M lookups,", n, "distinct u64 keys ---");
+        f64 tree = run<Dict<u64, i64>>("Dict (std::map)", keys, misses);
+        f64 node = run<std::unordered_map<u64, i64>>("std::unordered_map", keys, misses);
+        f64 flat = run<HashDict<u64, i64>>("HashDict", keys, misses);
+        println("Speedup:", tree / flat, "x vs Dict,", node / flat, "x vs unordered_map\n");
+    }
+
+    return 0;
+}
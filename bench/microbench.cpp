@@ -28,7 +28,7 @@ int main() {
 
     print("--- max() ---");
     f64 daxe_max = benchmark("dax::max(v)", N, [&]() {
-        volatile i64 r = max(data);
+        volatile i64 r = max(data).value();
         (void)r;
     });
     f64 std_max = benchmark("std::max_element", N, [&]() {
@@ -59,6 +59,29 @@ int main() {
     });
     print("Overhead:", (daxe_has - std_find), "ns\n");
 
+    print("--- count() ---");
+    f64 daxe_count = benchmark("dax::count(v, x)", N, [&]() {
+        volatile i64 r = count(data, 500LL);
+        (void)r;
+    });
+    f64 std_count = benchmark("std::count", N, [&]() {
+        volatile i64 r = std::count(data.begin(), data.end(), 500LL);
+        (void)r;
+    });
+    print("Overhead:", (daxe_count - std_count), "ns\n");
+
+    print("--- List::indexof() ---");
+    List<i64> list(data.begin(), data.end());
+    f64 daxe_indexof = benchmark("List::indexof(x)", N, [&]() {
+        volatile i64 r = list.indexof(500);
+        (void)r;
+    });
+    f64 std_indexof = benchmark("std::find - begin", N, [&]() {
+        volatile i64 r = std::find(data.begin(), data.end(), 500LL) - data.begin();
+        (void)r;
+    });
+    print("Overhead:", (daxe_indexof - std_indexof), "ns\n");
+
     print("=== Benchmark Complete ===");
     return 0;
 }
@@ -0,0 +1,56 @@
+#include <daxe.h>
+#include <daxe/compat.h>
+#include <chrono>
+#include <random>
+
+using namespace dax;
+
+template<typename Func>
+f64 benchmark(const str& name, i64 iterations, Func&& f) {
+    auto start = std::chrono::high_resolution_clock::now();
+    for (i64 i = 0; i < iterations; ++i) {
+        f();
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+    f64 us = std::chrono::duration<f64, std::micro>(end - start).count() / iterations;
+    println(name, ":", us, "us/op");
+    return us;
+}
+
+int main() {
+    println("=== Static Search Benchmark ===\n");
+
+    std::mt19937 gen(42);
+
+    for (i64 n : {1LL << 12, 1LL << 20, 1LL << 24}) {
+        std::uniform_int_distribution<i32> dist(0, std::numeric_limits<i32>::max());
+        vi32 data(n);
+        for (auto& x : data) x = dist(gen);
+        std::sort(data.begin(), data.end());
+
+        vi32 queries(1 << 20);
+        for (auto& x : queries) x = dist(gen);
+
+        StaticSearch<i32> layout(data);
+        const i64 N = 5;
+
+        println("--- 1M lookups into", n, "sorted i32 ---");
+        f64 stdtime = benchmark("std::lower_bound", N, [&]() {
+            i64 acc = 0;
+            for (i32 q : queries) acc += std::lower_bound(data.begin(), data.end(), q) - data.begin();
+            volatile i64 r = acc;
+            (void)r;
+        });
+
+        f64 time = benchmark("StaticSearch::indexlower", N, [&]() {
+            i64 acc = 0;
+            for (i32 q : queries) acc += layout.indexlower(q);
+            volatile i64 r = acc;
+            (void)r;
+        });
+
+        println("Speedup:", stdtime / time, "x faster\n");
+    }
+
+    return 0;
+}
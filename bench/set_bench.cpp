@@ -0,0 +1,48 @@
+#include <daxe.h>
+#include <daxe/compat.h>
+#include <chrono>
+#include <random>
+
+using namespace dax;
+
+template<typename Func>
+f64 benchmark(const str& name, i64 iterations, Func&& f) {
+    auto start = std::chrono::high_resolution_clock::now();
+    for (i64 i = 0; i < iterations; ++i) {
+        f();
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+    f64 ms = std::chrono::duration<f64, std::milli>(end - start).count() / iterations;
+    println(name, ":", ms, "ms");
+    return ms;
+}
+
+// Element-wise lookups, as Set did before it merged
+Set<i64> lookupintersect(const Set<i64>& a, const Set<i64>& b) { Set<i64> r; for (i64 x : a) if (b.has(x)) r.insert(x); return r; }
+
+int main() {
+    println("=== Set Algebra Benchmark ===\n");
+
+    std::mt19937_64 gen(42);
+    auto randoms = [&](i64 n) { vi64 v(static_cast<size_t>(n)); for (auto& x : v) x = static_cast<i64>(gen() % 4000000); return v; };
+
+    for (i64 nb : {1000000LL, 10000LL}) {
+        const vi64 va = randoms(1000000), vb = randoms(nb);
+        const Set<i64> a(va.begin(), va.end()), b(vb.begin(), vb.end());
+        const FlatSet<i64> fa(va), fb(vb);
+
+        println("--- 1M x", nb, "intersect ---");
+        f64 old = benchmark("Set (lookups)", 5, [&]() { volatile size_t r = lookupintersect(a, b).size(); (void)r; });
+        benchmark("Set (merge)", 5, [&]() { volatile size_t r = a.intersect(b).size(); (void)r; });
+        f64 flat = benchmark("FlatSet", 5, [&]() { volatile size_t r = fa.intersect(fb).size(); (void)r; });
+        println("Speedup:", old / flat, "x\n");
+    }
+
+    println("--- build from 1M values ---");
+    const vi64 v = randoms(1000000);
+    f64 tree = benchmark("Set", 5, [&]() { volatile size_t r = Set<i64>(v.begin(), v.end()).size(); (void)r; });
+    f64 flat = benchmark("FlatSet", 5, [&]() { volatile size_t r = FlatSet<i64>(v).size(); (void)r; });
+    println("Speedup:", tree / flat, "x");
+
+    return 0;
+}
@@ -0,0 +1,47 @@
+#include <daxe.h>
+#include <daxe/compat.h>
+#include <chrono>
+#include <random>
+
+using namespace dax;
+
+template<typename Func>
+f64 benchmark(const str& name, i64 iterations, Func&& f) {
+    auto start = std::chrono::high_resolution_clock::now();
+    for (i64 i = 0; i < iterations; ++i) {
+        f();
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+    f64 ms = std::chrono::duration<f64, std::milli>(end - start).count() / iterations;
+    println(name, ":", ms, "ms");
+    return ms;
+}
+
+// Build a random graph of average degree 3 and sum over every adjacency list
+template <typename Adj>
+f64 run(const str& name, const std::vector<pi32>& edges, i32 n) {
+    return benchmark(name, 5, [&]() {
+        std::vector<Adj> adj(static_cast<size_t>(n));
+        for (auto [u, v] : edges) { adj[static_cast<size_t>(u)].append(v); adj[static_cast<size_t>(v)].append(u); }
+        i64 acc = 0;
+        for (const auto& a : adj) acc += a.sum();
+        volatile i64 r = acc;
+        (void)r;
+    });
+}
+
+int main() {
+    println("=== Small List Benchmark ===\n");
+
+    std::mt19937 gen(42);
+    const i32 n = 1 << 20;
+    std::vector<pi32> edges(static_cast<size_t>(n) * 3 / 2);
+    for (auto& [u, v] : edges) { u = static_cast<i32>(gen() % n); v = static_cast<i32>(gen() % n); }
+
+    println("--- 1M vertices, 1.5M edges ---");
+    f64 heap = run<List<i32>>("List", edges, n);
+    f64 inl = run<SmallList<i32, 4>>("SmallList<i32, 4>", edges, n);
+    println("Speedup:", heap / inl, "x");
+
+    return 0;
+}
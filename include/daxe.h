@@ -37,6 +37,7 @@
 #include "daxe/base.h"
 #include "daxe/english.h"
 #include "daxe/pairs.h"
+#include "daxe/hash.h"
 #include "daxe/vectors.h"
 #include "daxe/containers.h"
 
@@ -49,16 +50,30 @@
 // I/O and functions
 #include "daxe/io.h"
 #include "daxe/math.h"
+#include "daxe/simd.h"
 #include "daxe/functions.h"
 #include "daxe/random.h"
 #include "daxe/time.h"
 #include "daxe/convert.h"
+#include "daxe/strings.h"
 
 // Pythonic features
 #include "daxe/pythonic.h"
+#include "daxe/hashtable.h"
+#include "daxe/search.h"
+#include "daxe/memo.h"
+#include "daxe/trie.h"
+#include "daxe/intern.h"
+#include "daxe/flat.h"
+#include "daxe/smallvec.h"
+#include "daxe/chunked.h"
 #include "daxe/range.h"
 #include "daxe/grid.h"
 #include "daxe/graph.h"
+#include "daxe/suffix.h"
+
+// Parallel execution
+#include "daxe/parallel.h"
 
 // Debug utilities
 #include "daxe/debug.h"
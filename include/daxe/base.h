@@ -11,6 +11,7 @@
 #include "config.h"
 #include <cstdint>
 #include <string>
+#include <string_view>
 
 DAXE_NAMESPACE_BEGIN
 
@@ -56,6 +57,7 @@ using f80 = long double;
 // ==========================================
 using str = std::string;
 using String = std::string;
+using strview = std::string_view;
 
 // ==========================================
 // BOOLEAN
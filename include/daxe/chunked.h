@@ -0,0 +1,351 @@
+/*
+ * DAXE - CHUNKED LIST
+ * D.A's Axe - Cut through C++ verbosity
+ *
+ * ChunkedList<T> - sequence split into blocks of about sqrt(n) elements.
+ * insertat, removeat, indexing, split and concat cost O(sqrt n) instead of
+ * shifting the whole vector, so editor-style workloads (10^6 edits in the
+ * middle of a 10^6 element list) run in seconds. Method names follow List.
+ *
+ *   ChunkedList<char> text(s.begin(), s.end());
+ *   text.insertat(cursor, 'x');
+ *   ChunkedList<char> tail = text.split(cursor);
+ *
+ * Naming: Flat style (no snake_case)
+ */
+
+#ifndef DAXE_CHUNKED_H
+#define DAXE_CHUNKED_H
+
+#include "base.h"
+#include "safe.h"
+#include "simd.h"
+#include "pythonic.h"
+#include <algorithm>
+#include <cmath>
+#include <initializer_list>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+DAXE_NAMESPACE_BEGIN
+
+// ==========================================
+// CHUNKEDLIST CLASS
+// ==========================================
+// Blocks are never empty. The target block size is max(64, sqrt(size)); a
+// block is split in half when it grows past twice the target and merged
+// with a neighbour when the two fit in one target.
+template <typename T = i64>
+class ChunkedList {
+    static constexpr size_t BLOCKMIN = 64;
+
+    using Block = std::vector<T>;
+    std::vector<Block> blocks_;
+    size_t size_ = 0;
+
+    DAXE_NODISCARD size_t target() const noexcept {
+        return std::max(BLOCKMIN, static_cast<size_t>(std::sqrt(static_cast<f64>(size_))));
+    }
+
+    // (block, offset) of element i; i == size_ gives the end of the last block
+    DAXE_NODISCARD std::pair<size_t, size_t> locate(size_t i) const noexcept {
+        if (i <= size_ / 2) {
+            size_t b = 0;
+            while (b + 1 < blocks_.size() && i >= blocks_[b].size()) i -= blocks_[b++].size();
+            return {b, i};
+        }
+        size_t b = blocks_.size() - 1, back = size_ - i;   // elements from i to the end
+        while (back > blocks_[b].size()) back -= blocks_[b--].size();
+        return {b, blocks_[b].size() - back};
+    }
+
+    // After removing from block b: drop it if empty, else merge it with a
+    // neighbour when the two fit in one target. Blocks shrunk elsewhere are
+    // not revisited, so re-chunk once there are twice as many as needed; that
+    // takes about n / 2 removals, keeping the O(n) rebuild amortized O(1).
+    void settle(size_t b) {
+        if (blocks_[b].empty()) {
+            blocks_.erase(blocks_.begin() + static_cast<std::ptrdiff_t>(b));
+        } else {
+            if (b + 1 < blocks_.size() && blocks_[b].size() + blocks_[b + 1].size() <= target()) absorb(b);
+            if (b > 0 && blocks_[b - 1].size() + blocks_[b].size() <= target()) absorb(b - 1);
+        }
+        if (blocks_.size() > 2 * size_ / target() + 2) rebuild(flat());
+    }
+
+    // Moves block b + 1 onto the end of block b
+    void absorb(size_t b) {
+        Block& next = blocks_[b + 1];
+        blocks_[b].insert(blocks_[b].end(), std::make_move_iterator(next.begin()), std::make_move_iterator(next.end()));
+        blocks_.erase(blocks_.begin() + static_cast<std::ptrdiff_t>(b) + 1);
+    }
+
+    DAXE_NODISCARD bool normalize(i64& idx) const noexcept {
+        if (idx < 0) idx += static_cast<i64>(size_);
+        return idx >= 0 && idx < static_cast<i64>(size_);
+    }
+
+    template <bool CONST>
+    class Iter {
+        using Blocks = std::conditional_t<CONST, const std::vector<Block>, std::vector<Block>>;
+        Blocks* blocks_ = nullptr;
+        size_t b_ = 0, i_ = 0;
+
+    public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = std::conditional_t<CONST, const T*, T*>;
+        using reference = std::conditional_t<CONST, const T&, T&>;
+
+        Iter() = default;
+        Iter(Blocks* blocks, size_t b, size_t i) noexcept : blocks_(blocks), b_(b), i_(i) {}
+        operator Iter<true>() const noexcept { return Iter<true>(blocks_, b_, i_); }
+
+        DAXE_NODISCARD reference operator*() const noexcept { return (*blocks_)[b_][i_]; }
+        DAXE_NODISCARD pointer operator->() const noexcept { return &(*blocks_)[b_][i_]; }
+        Iter& operator++() noexcept { if (++i_ == (*blocks_)[b_].size()) { ++b_; i_ = 0; } return *this; }
+        Iter operator++(int) noexcept { Iter r = *this; ++*this; return r; }
+        Iter& operator--() noexcept { if (i_ == 0) i_ = (*blocks_)[--b_].size(); --i_; return *this; }
+        Iter operator--(int) noexcept { Iter r = *this; --*this; return r; }
+        DAXE_NODISCARD bool operator==(const Iter& o) const noexcept { return b_ == o.b_ && i_ == o.i_; }
+        DAXE_NODISCARD bool operator!=(const Iter& o) const noexcept { return !(*this == o); }
+    };
+
+public:
+    using value_type = T;
+    using size_type = size_t;
+    using iterator = Iter<false>;
+    using const_iterator = Iter<true>;
+
+    ChunkedList() = default;
+    ChunkedList(std::initializer_list<T> init) { extend(init); }
+    template <typename It, std::enable_if_t<!std::is_integral_v<It>, int> = 0>
+    ChunkedList(It first, It last) { for (; first != last; ++first) append(*first); }
+    explicit ChunkedList(const List<T>& l) { extend(l); }
+
+    DAXE_NODISCARD size_t size() const noexcept { return size_; }
+    DAXE_NODISCARD bool empty() const noexcept { return size_ == 0; }
+    DAXE_NODISCARD size_t blocks() const noexcept { return blocks_.size(); }
+    void clear() noexcept { blocks_.clear(); size_ = 0; }
+
+    DAXE_NODISCARD iterator begin() noexcept { return iterator(&blocks_, 0, 0); }
+    DAXE_NODISCARD iterator end() noexcept { return iterator(&blocks_, blocks_.size(), 0); }
+    DAXE_NODISCARD const_iterator begin() const noexcept { return const_iterator(&blocks_, 0, 0); }
+    DAXE_NODISCARD const_iterator end() const noexcept { return const_iterator(&blocks_, blocks_.size(), 0); }
+
+    // O(sqrt n) positional access
+    DAXE_NODISCARD T& operator[](size_t i) noexcept { auto [b, o] = locate(i); return blocks_[b][o]; }
+    DAXE_NODISCARD const T& operator[](size_t i) const noexcept { auto [b, o] = locate(i); return blocks_[b][o]; }
+    DAXE_NODISCARD T& at(size_t i) { if (i >= size_) DAXE_UNLIKELY panic("ChunkedList::at: index out of range"); return (*this)[i]; }
+    DAXE_NODISCARD const T& at(size_t i) const { if (i >= size_) DAXE_UNLIKELY panic("ChunkedList::at: index out of range"); return (*this)[i]; }
+    DAXE_NODISCARD T& front() noexcept { return blocks_.front().front(); }
+    DAXE_NODISCARD T& back() noexcept { return blocks_.back().back(); }
+    DAXE_NODISCARD const T& front() const noexcept { return blocks_.front().front(); }
+    DAXE_NODISCARD const T& back() const noexcept { return blocks_.back().back(); }
+
+    template <typename U> void append(U&& x) {
+        if (blocks_.empty() || blocks_.back().size() >= target()) blocks_.emplace_back().reserve(target());
+        blocks_.back().push_back(std::forward<U>(x));
+        ++size_;
+    }
+
+    DAXE_NODISCARD Option<T> pop() {
+        if (empty()) DAXE_UNLIKELY return None;
+        T val = std::move(blocks_.back().back());
+        blocks_.back().pop_back();
+        --size_;
+        settle(blocks_.size() - 1);
+        return Some(std::move(val));
+    }
+    DAXE_NODISCARD T pop(const T& fallback) {
+        if (empty()) DAXE_UNLIKELY return fallback;
+        return pop().unwrap();
+    }
+
+    template <typename Range>
+    void extend(const Range& other) { for (const auto& x : other) append(x); }
+
+    // Same clamping as List::insertat
+    void insertat(i64 idx, const T& x) {
+        const i64 n = static_cast<i64>(size_);
+        if (idx < 0) idx += n;
+        if (idx < 0) idx = 0;
+        if (idx > n) idx = n;
+        if (idx == n) { append(x); return; }
+        auto [b, o] = locate(static_cast<size_t>(idx));
+        Block& block = blocks_[b];
+        block.insert(block.begin() + static_cast<std::ptrdiff_t>(o), x);
+        ++size_;
+        if (block.size() > 2 * target()) splitat(b, block.size() / 2);
+    }
+
+    void removeat(i64 idx) {
+        if (!normalize(idx)) return;
+        auto [b, o] = locate(static_cast<size_t>(idx));
+        blocks_[b].erase(blocks_[b].begin() + static_cast<std::ptrdiff_t>(o));
+        --size_;
+        settle(b);
+    }
+
+    bool remove(const T& x) {
+        for (size_t b = 0; b < blocks_.size(); ++b) {
+            const size_t o = detail::findin(blocks_[b], x);
+            if (o == blocks_[b].size()) continue;
+            blocks_[b].erase(blocks_[b].begin() + static_cast<std::ptrdiff_t>(o));
+            --size_;
+            settle(b);
+            return true;
+        }
+        return false;
+    }
+
+    DAXE_NODISCARD i64 indexof(const T& x) const noexcept {
+        size_t base = 0;
+        for (const Block& block : blocks_) {
+            const size_t o = detail::findin(block, x);
+            if (o != block.size()) return static_cast<i64>(base + o);
+            base += block.size();
+        }
+        return -1;
+    }
+    DAXE_NODISCARD i64 count(const T& x) const noexcept {
+        size_t c = 0;
+        for (const Block& block : blocks_) c += detail::countin(block, x);
+        return static_cast<i64>(c);
+    }
+    DAXE_NODISCARD bool has(const T& x) const noexcept { return indexof(x) != -1; }
+
+    DAXE_NODISCARD Option<T> getat(i64 idx) const noexcept {
+        if (!normalize(idx)) DAXE_UNLIKELY return None;
+        return Some((*this)[static_cast<size_t>(idx)]);
+    }
+    DAXE_NODISCARD T getor(i64 idx, const T& def) const noexcept {
+        if (!normalize(idx)) DAXE_UNLIKELY return def;
+        return (*this)[static_cast<size_t>(idx)];
+    }
+
+    // Moves [idx, size) into the returned list and keeps [0, idx): O(sqrt n)
+    DAXE_NODISCARD ChunkedList split(i64 idx) {
+        if (idx < 0) idx += static_cast<i64>(size_);
+        idx = std::clamp<i64>(idx, 0, static_cast<i64>(size_));
+        ChunkedList tail;
+        if (static_cast<size_t>(idx) == size_) return tail;
+        auto [b, o] = locate(static_cast<size_t>(idx));
+        if (o > 0) { splitat(b, o); ++b; }
+        tail.blocks_.assign(std::make_move_iterator(blocks_.begin() + static_cast<std::ptrdiff_t>(b)), std::make_move_iterator(blocks_.end()));
+        blocks_.erase(blocks_.begin() + static_cast<std::ptrdiff_t>(b), blocks_.end());
+        tail.size_ = size_ - static_cast<size_t>(idx);
+        size_ = static_cast<size_t>(idx);
+        return tail;
+    }
+
+    // Appends other's blocks without copying elements: O(sqrt n)
+    void concat(ChunkedList&& other) {
+        if (other.empty()) return;
+        const size_t seam = blocks_.size();
+        blocks_.insert(blocks_.end(), std::make_move_iterator(other.blocks_.begin()), std::make_move_iterator(other.blocks_.end()));
+        size_ += other.size_;
+        other.clear();
+        if (seam > 0) settle(seam - 1);
+    }
+    void concat(const ChunkedList& other) { concat(ChunkedList(other)); }
+
+    DAXE_NODISCARD ChunkedList slice(i64 start, i64 end) const {
+        if (!detail::normalizeslice(start, end, static_cast<i64>(size_))) DAXE_UNLIKELY return {};
+        ChunkedList r;
+        auto [b, o] = locate(static_cast<size_t>(start));
+        for (i64 k = start; k < end; ++k) {
+            r.append(blocks_[b][o]);
+            if (++o == blocks_[b].size()) { ++b; o = 0; }
+        }
+        return r;
+    }
+
+    // Whole-list operations flatten, work on one vector and re-chunk
+    void sort() { std::vector<T> v = flat(); detail::sortcontainer(v); rebuild(std::move(v)); }
+    void rsort() { std::vector<T> v = flat(); detail::sortcontainerdesc(v); rebuild(std::move(v)); }
+    void reverse() {
+        std::reverse(blocks_.begin(), blocks_.end());
+        for (Block& block : blocks_) std::reverse(block.begin(), block.end());
+    }
+    DAXE_NODISCARD ChunkedList sorted() const { ChunkedList copy = *this; copy.sort(); return copy; }
+    DAXE_NODISCARD ChunkedList reversed() const { ChunkedList copy = *this; copy.reverse(); return copy; }
+    void unique() { std::vector<T> v = flat(); v.erase(std::unique(v.begin(), v.end()), v.end()); rebuild(std::move(v)); }
+
+    DAXE_NODISCARD T sum() const noexcept { T s{}; for (const Block& block : blocks_) s += detail::sumof(block); return s; }
+    DAXE_NODISCARD Option<T> max() const { if (empty()) return None; return Some(maxvalue()); }
+    DAXE_NODISCARD Option<T> min() const { if (empty()) return None; return Some(minvalue()); }
+    DAXE_NODISCARD T max(const T& fallback) const { if (empty()) return fallback; return maxvalue(); }
+    DAXE_NODISCARD T min(const T& fallback) const { if (empty()) return fallback; return minvalue(); }
+
+    template <typename Func>
+    DAXE_NODISCARD ChunkedList filter(Func&& f) const {
+        ChunkedList result;
+        for (const auto& x : *this) if (f(x)) result.append(x);
+        return result;
+    }
+    template <typename Func>
+    DAXE_NODISCARD auto transform(Func&& f) const {
+        using U = decltype(f(std::declval<T>()));
+        ChunkedList<U> result;
+        for (const auto& x : *this) result.append(f(x));
+        return result;
+    }
+
+    template <typename Func> DAXE_NODISCARD bool any(Func&& f) const noexcept { for (const auto& x : *this) if (f(x)) DAXE_LIKELY return true; return false; }
+    template <typename Func> DAXE_NODISCARD bool every(Func&& f) const noexcept { for (const auto& x : *this) if (!f(x)) DAXE_UNLIKELY return false; return true; }
+    template <typename Func> DAXE_NODISCARD bool none(Func&& f) const noexcept { return !any(std::forward<Func>(f)); }
+
+    DAXE_NODISCARD List<T> tolist() const {
+        List<T> r;
+        r.reserve(size_);
+        for (const Block& block : blocks_) r.insert(r.end(), block.begin(), block.end());
+        return r;
+    }
+
+private:
+    // Splits block b so that its first o elements stay and the rest follow it
+    void splitat(size_t b, size_t o) {
+        Block& block = blocks_[b];
+        const auto mid = block.begin() + static_cast<std::ptrdiff_t>(o);
+        Block right(std::make_move_iterator(mid), std::make_move_iterator(block.end()));
+        block.erase(mid, block.end());
+        blocks_.insert(blocks_.begin() + static_cast<std::ptrdiff_t>(b) + 1, std::move(right));
+    }
+
+    DAXE_NODISCARD std::vector<T> flat() {
+        std::vector<T> v;
+        v.reserve(size_);
+        for (Block& block : blocks_) v.insert(v.end(), std::make_move_iterator(block.begin()), std::make_move_iterator(block.end()));
+        return v;
+    }
+    void rebuild(std::vector<T>&& v) {
+        clear();
+        size_ = v.size();
+        const size_t t = target();
+        for (size_t i = 0; i < v.size(); i += t) {
+            const auto first = v.begin() + static_cast<std::ptrdiff_t>(i);
+            blocks_.emplace_back(std::make_move_iterator(first), std::make_move_iterator(first + static_cast<std::ptrdiff_t>(std::min(t, v.size() - i))));
+        }
+    }
+
+    DAXE_NODISCARD T maxvalue() const {
+        T best = detail::maxof(blocks_.front());
+        for (size_t b = 1; b < blocks_.size(); ++b) best = std::max(best, detail::maxof(blocks_[b]));
+        return best;
+    }
+    DAXE_NODISCARD T minvalue() const {
+        T best = detail::minof(blocks_.front());
+        for (size_t b = 1; b < blocks_.size(); ++b) best = std::min(best, detail::minof(blocks_[b]));
+        return best;
+    }
+};
+
+template <typename T> ChunkedList(std::initializer_list<T>) -> ChunkedList<T>;
+
+DAXE_NAMESPACE_END
+
+#endif // DAXE_CHUNKED_H
@@ -98,6 +98,17 @@
     #define DAXE_HAS_RANGES 0
 #endif
 
+// std::span - C++20+ (header checked directly, config.h includes nothing)
+#if DAXE_CPP20 && defined(__has_include)
+    #if __has_include(<span>)
+        #define DAXE_HAS_SPAN 1
+    #else
+        #define DAXE_HAS_SPAN 0
+    #endif
+#else
+    #define DAXE_HAS_SPAN 0
+#endif
+
 // std::expected - C++23+
 #if DAXE_CPP23 && defined(__cpp_lib_expected)
     #define DAXE_HAS_EXPECTED 1
@@ -229,4 +240,25 @@
     #define DAXE_MACOS 0
 #endif
 
+// ==========================================
+// SIMD DETECTION
+// ==========================================
+// x86-64: AVX2 kernels carry a target attribute and are chosen at runtime.
+// AArch64: NEON is part of the base ISA. Define DAXE_NO_SIMD to opt out.
+#if !defined(DAXE_NO_SIMD) && (defined(__GNUC__) || defined(__clang__)) && defined(__x86_64__)
+    #define DAXE_SIMD_AVX2 1
+    #define DAXE_SIMD_NEON 0
+    #define DAXE_SIMD_TARGET __attribute__((target("avx2,bmi,popcnt")))
+#elif !defined(DAXE_NO_SIMD) && (defined(__aarch64__) || defined(_M_ARM64))
+    #define DAXE_SIMD_AVX2 0
+    #define DAXE_SIMD_NEON 1
+    #define DAXE_SIMD_TARGET
+#else
+    #define DAXE_SIMD_AVX2 0
+    #define DAXE_SIMD_NEON 0
+    #define DAXE_SIMD_TARGET
+#endif
+
+#define DAXE_HAS_SIMD (DAXE_SIMD_AVX2 || DAXE_SIMD_NEON)
+
 #endif // DAXE_CONFIG_H
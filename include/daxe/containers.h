@@ -7,6 +7,7 @@
 #define DAXE_CONTAINERS_H
 
 #include "vectors.h"
+#include "hash.h"
 #include <set>
 #include <map>
 #include <unordered_set>
@@ -31,10 +32,16 @@ using msi32 = std::multiset<i32>;
 using msi64 = std::multiset<i64>;
 using msstr = std::multiset<str>;
 
+// Unordered sets and maps use dax::Hash: seeded, and defined for pairs and tuples
+template <typename T> using uset = std::unordered_set<T, Hash>;
+template <typename K, typename V> using umap = std::unordered_map<K, V, Hash>;
+
 // Unordered sets
-using usi32 = std::unordered_set<i32>;
-using usi64 = std::unordered_set<i64>;
-using usstr = std::unordered_set<str>;
+using usi32 = uset<i32>;
+using usi64 = uset<i64>;
+using usstr = uset<str>;
+using uspi32 = uset<pi32>;
+using uspi64 = uset<pi64>;
 
 // Maps
 using mi32i32 = std::map<i32, i32>;
@@ -51,11 +58,13 @@ using mpi32i32 = std::map<pi32, i32>;
 using mpi64i64 = std::map<pi64, i64>;
 
 // Unordered maps
-using umi32i32 = std::unordered_map<i32, i32>;
-using umi64i64 = std::unordered_map<i64, i64>;
-using umstri32 = std::unordered_map<str, i32>;
-using umstri64 = std::unordered_map<str, i64>;
-using umstrstr = std::unordered_map<str, str>;
+using umi32i32 = umap<i32, i32>;
+using umi64i64 = umap<i64, i64>;
+using umstri32 = umap<str, i32>;
+using umstri64 = umap<str, i64>;
+using umstrstr = umap<str, str>;
+using umpi32i32 = umap<pi32, i32>;
+using umpi64i64 = umap<pi64, i64>;
 
 // Stacks
 using sti32 = std::stack<i32>;
@@ -16,6 +16,7 @@
 #include "daxe/base.h"
 #include "daxe/english.h"
 #include "daxe/pairs.h"
+#include "daxe/hash.h"
 #include "daxe/vectors.h"
 #include "daxe/containers.h"
 
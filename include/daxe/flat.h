@@ -0,0 +1,262 @@
+/*
+ * DAXE - FLAT SORTED CONTAINERS
+ * D.A's Axe - Cut through C++ verbosity
+ *
+ * FlatSet<T> / FlatMap<K, V> - Set / Dict kept as one sorted vector.
+ * Lookups are binary searches over contiguous memory and iteration is a
+ * linear scan. A single add shifts the tail, so build in bulk: the
+ * constructors and update() append, sort the new part and merge it in.
+ * Set algebra is an O(n + m) merge, galloping through the larger side
+ * when one set is much smaller.
+ *
+ * Naming: Flat style (no snake_case)
+ */
+
+#ifndef DAXE_FLAT_H
+#define DAXE_FLAT_H
+
+#include "base.h"
+#include "safe.h"
+#include "sort.h"
+#include "pythonic.h"
+#include <algorithm>
+#include <initializer_list>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+DAXE_NAMESPACE_BEGIN
+
+// ==========================================
+// FLATSET CLASS
+// ==========================================
+template <typename T = i64>
+class FlatSet {
+    std::vector<T> data_;
+
+    // Sorts and dedupes data_[from, end) and merges it into the sorted prefix
+    void mergetail(size_t from) {
+        const auto mid = data_.begin() + static_cast<std::ptrdiff_t>(from);
+        std::vector<T> tail(std::make_move_iterator(mid), std::make_move_iterator(data_.end()));
+        data_.erase(mid, data_.end());
+        detail::sortcontainer(tail);
+        if (data_.empty() || tail.empty() || data_.back() < tail.front()) {
+            data_.insert(data_.end(), std::make_move_iterator(tail.begin()), std::make_move_iterator(tail.end()));
+        } else {
+            const size_t n = data_.size();
+            data_.insert(data_.end(), std::make_move_iterator(tail.begin()), std::make_move_iterator(tail.end()));
+            std::inplace_merge(data_.begin(), data_.begin() + static_cast<std::ptrdiff_t>(n), data_.end());
+        }
+        data_.erase(std::unique(data_.begin(), data_.end()), data_.end());
+    }
+
+    static FlatSet fromsorted(std::vector<T>&& v) { FlatSet r; r.data_ = std::move(v); return r; }
+
+public:
+    using value_type = T;
+    using iterator = typename std::vector<T>::const_iterator;
+    using const_iterator = iterator;
+
+    FlatSet() = default;
+    FlatSet(std::initializer_list<T> init) : data_(init) { mergetail(0); }
+    explicit FlatSet(std::vector<T> v) : data_(std::move(v)) { mergetail(0); }
+    template <typename It>
+    FlatSet(It first, It last) : data_(first, last) { mergetail(0); }
+
+    // O(n) per call: prefer update() for many elements
+    template <typename U> bool add(U&& x) {
+        auto it = std::lower_bound(data_.begin(), data_.end(), x);
+        if (it != data_.end() && !(x < *it)) return false;
+        data_.insert(it, T(std::forward<U>(x)));
+        return true;
+    }
+
+    // Bulk insert: append, sort the new part, merge once
+    template <typename Range>
+    void update(const Range& r) {
+        const size_t from = data_.size();
+        data_.insert(data_.end(), std::begin(r), std::end(r));
+        mergetail(from);
+    }
+    void update(std::initializer_list<T> r) { update<std::initializer_list<T>>(r); }
+
+    DAXE_NODISCARD bool has(const T& x) const noexcept { return std::binary_search(data_.begin(), data_.end(), x); }
+    bool remove(const T& x) {
+        auto it = std::lower_bound(data_.begin(), data_.end(), x);
+        if (it == data_.end() || x < *it) return false;
+        data_.erase(it);
+        return true;
+    }
+    // Removes and returns the smallest element, like Set::pop
+    DAXE_NODISCARD Option<T> pop() {
+        if (data_.empty()) DAXE_UNLIKELY return None;
+        T val = std::move(data_.front());
+        data_.erase(data_.begin());
+        return Some(std::move(val));
+    }
+
+    // Number of elements less than x
+    DAXE_NODISCARD i64 rank(const T& x) const noexcept { return std::lower_bound(data_.begin(), data_.end(), x) - data_.begin(); }
+
+    DAXE_NODISCARD FlatSet unite(const FlatSet& other) const {
+        std::vector<T> r;
+        r.reserve(data_.size() + other.data_.size());
+        std::set_union(data_.begin(), data_.end(), other.data_.begin(), other.data_.end(), std::back_inserter(r));
+        return fromsorted(std::move(r));
+    }
+    DAXE_NODISCARD FlatSet intersect(const FlatSet& other) const {
+        std::vector<T> r;
+        detail::sortedintersect(data_.begin(), data_.end(), other.data_.begin(), other.data_.end(), std::back_inserter(r));
+        return fromsorted(std::move(r));
+    }
+    DAXE_NODISCARD FlatSet difference(const FlatSet& other) const {
+        std::vector<T> r;
+        detail::sorteddifference(data_.begin(), data_.end(), other.data_.begin(), other.data_.end(), std::back_inserter(r));
+        return fromsorted(std::move(r));
+    }
+    DAXE_NODISCARD FlatSet symmetricdiff(const FlatSet& other) const {
+        std::vector<T> r;
+        std::set_symmetric_difference(data_.begin(), data_.end(), other.data_.begin(), other.data_.end(), std::back_inserter(r));
+        return fromsorted(std::move(r));
+    }
+    DAXE_NODISCARD bool issubset(const FlatSet& other) const {
+        return detail::sortedincludes(other.data_.begin(), other.data_.end(), data_.begin(), data_.end());
+    }
+    DAXE_NODISCARD bool issuperset(const FlatSet& other) const { return other.issubset(*this); }
+
+    DAXE_NODISCARD bool operator==(const FlatSet& other) const { return data_ == other.data_; }
+    DAXE_NODISCARD bool operator!=(const FlatSet& other) const { return data_ != other.data_; }
+
+    // k-th smallest
+    DAXE_NODISCARD const T& operator[](size_t k) const noexcept { return data_[k]; }
+    DAXE_NODISCARD const std::vector<T>& vec() const noexcept { return data_; }
+    DAXE_NODISCARD List<T> tolist() const { return List<T>(data_.begin(), data_.end()); }
+
+    DAXE_NODISCARD size_t size() const noexcept { return data_.size(); }
+    DAXE_NODISCARD bool empty() const noexcept { return data_.empty(); }
+    void clear() noexcept { data_.clear(); }
+    void reserve(size_t n) { data_.reserve(n); }
+
+    DAXE_NODISCARD iterator begin() const noexcept { return data_.begin(); }
+    DAXE_NODISCARD iterator end() const noexcept { return data_.end(); }
+};
+
+template <typename T> FlatSet(std::initializer_list<T>) -> FlatSet<T>;
+template <typename T> FlatSet(std::vector<T>) -> FlatSet<T>;
+
+// ==========================================
+// FLATMAP CLASS
+// ==========================================
+// Entries sorted by key. As with Dict, the constructors keep the first
+// value given for a key and update() lets the incoming value win.
+template <typename K = str, typename V = i64>
+class FlatMap {
+    using Entry = std::pair<K, V>;
+    std::vector<Entry> data_;
+
+    struct KeyLess {
+        DAXE_NODISCARD bool operator()(const Entry& a, const Entry& b) const { return a.first < b.first; }
+        DAXE_NODISCARD bool operator()(const Entry& a, const K& b) const { return a.first < b; }
+        DAXE_NODISCARD bool operator()(const K& a, const Entry& b) const { return a < b.first; }
+    };
+
+    DAXE_NODISCARD auto seek(const K& key) const { return std::lower_bound(data_.begin(), data_.end(), key, KeyLess{}); }
+    DAXE_NODISCARD auto seek(const K& key) { return std::lower_bound(data_.begin(), data_.end(), key, KeyLess{}); }
+    DAXE_NODISCARD const Entry* find(const K& key) const {
+        auto it = seek(key);
+        return it != data_.end() && !(key < it->first) ? &*it : nullptr;
+    }
+
+    // Sorts data_[from, end) by key and merges it in; on equal keys the
+    // older entry wins when keepold, the newer one otherwise
+    void mergetail(size_t from, bool keepold) {
+        const auto mid = data_.begin() + static_cast<std::ptrdiff_t>(from);
+        std::stable_sort(mid, data_.end(), KeyLess{});
+        std::inplace_merge(data_.begin(), mid, data_.end(), KeyLess{});   // stable: old before new
+        size_t w = 0;
+        for (size_t i = 0; i < data_.size(); ++i) {
+            if (w > 0 && !(data_[w - 1].first < data_[i].first)) {
+                if (!keepold) data_[w - 1].second = std::move(data_[i].second);
+                continue;
+            }
+            if (w != i) data_[w] = std::move(data_[i]);
+            ++w;
+        }
+        data_.erase(data_.begin() + static_cast<std::ptrdiff_t>(w), data_.end());
+    }
+
+public:
+    using key_type = K;
+    using mapped_type = V;
+    using value_type = Entry;
+    using iterator = typename std::vector<Entry>::iterator;
+    using const_iterator = typename std::vector<Entry>::const_iterator;
+
+    FlatMap() = default;
+    FlatMap(std::initializer_list<Entry> init) : data_(init) { mergetail(0, true); }
+    explicit FlatMap(std::vector<Entry> v) : data_(std::move(v)) { mergetail(0, true); }
+
+    V& operator[](const K& key) {
+        auto it = seek(key);
+        if (it == data_.end() || key < it->first) it = data_.insert(it, Entry(key, V{}));
+        return it->second;
+    }
+
+    DAXE_NODISCARD bool has(const K& key) const { return find(key) != nullptr; }
+    DAXE_NODISCARD Option<V> getat(const K& key) const { const Entry* e = find(key); return e ? Some(e->second) : None; }
+    DAXE_NODISCARD V getor(const K& key, const V& def) const { const Entry* e = find(key); return e ? e->second : def; }
+    DAXE_NODISCARD V get(const K& key, const V& def) const { return getor(key, def); }
+
+    template <typename VV> void set(const K& key, VV&& value) { (*this)[key] = std::forward<VV>(value); }
+    V& setdefault(const K& key, const V& def) {
+        auto it = seek(key);
+        if (it == data_.end() || key < it->first) it = data_.insert(it, Entry(key, def));
+        return it->second;
+    }
+
+    bool remove(const K& key) {
+        auto it = seek(key);
+        if (it == data_.end() || key < it->first) return false;
+        data_.erase(it);
+        return true;
+    }
+    DAXE_NODISCARD Option<V> pop(const K& key) {
+        auto it = seek(key);
+        if (it == data_.end() || key < it->first) DAXE_UNLIKELY return None;
+        V val = std::move(it->second);
+        data_.erase(it);
+        return Some(std::move(val));
+    }
+
+    DAXE_NODISCARD List<K> keys() const { List<K> r; r.reserve(data_.size()); for (const auto& [k, v] : data_) r.push_back(k); return r; }
+    DAXE_NODISCARD List<V> values() const { List<V> r; r.reserve(data_.size()); for (const auto& [k, v] : data_) r.push_back(v); return r; }
+    DAXE_NODISCARD List<Entry> items() const { return List<Entry>(data_.begin(), data_.end()); }
+
+    // Bulk insert or overwrite: one sort of the new entries and one merge
+    void update(const FlatMap& other) {
+        const size_t from = data_.size();
+        data_.insert(data_.end(), other.data_.begin(), other.data_.end());
+        mergetail(from, false);
+    }
+    void update(const std::vector<Entry>& entries) {
+        const size_t from = data_.size();
+        data_.insert(data_.end(), entries.begin(), entries.end());
+        mergetail(from, false);
+    }
+    void merge(const FlatMap& other) { update(other); }
+
+    DAXE_NODISCARD size_t size() const noexcept { return data_.size(); }
+    DAXE_NODISCARD bool empty() const noexcept { return data_.empty(); }
+    void clear() noexcept { data_.clear(); }
+    void reserve(size_t n) { data_.reserve(n); }
+
+    // Iteration in key order; do not modify the key through it
+    DAXE_NODISCARD iterator begin() noexcept { return data_.begin(); }
+    DAXE_NODISCARD iterator end() noexcept { return data_.end(); }
+    DAXE_NODISCARD const_iterator begin() const noexcept { return data_.begin(); }
+    DAXE_NODISCARD const_iterator end() const noexcept { return data_.end(); }
+};
+
+DAXE_NAMESPACE_END
+
+#endif // DAXE_FLAT_H
@@ -14,6 +14,9 @@
 #include "containers.h"
 #include "macros.h"
 #include "safe.h"
+#include "sort.h"
+#include "simd.h"
+#include "strings.h"
 #include <algorithm>
 #include <numeric>
 #include <cctype>
@@ -66,14 +69,14 @@ DAXE_NODISCARD constexpr T max(const T& a, const T& b) noexcept {
 template <typename T>
 DAXE_NODISCARD DAXE_ALWAYS_INLINE Option<T> max(const std::vector<T>& v) {
     if (v.empty()) return None;
-    return Some(*std::max_element(v.begin(), v.end()));
+    return Some(detail::maxof(v));
 }
 
 // max - vector with fallback
 template <typename T>
 DAXE_NODISCARD DAXE_ALWAYS_INLINE T max(const std::vector<T>& v, const T& fallback) {
     if (v.empty()) return fallback;
-    return *std::max_element(v.begin(), v.end());
+    return detail::maxof(v);
 }
 
 // max - any other container (fallback with SFINAE) - Safe by default
@@ -95,14 +98,14 @@ DAXE_NODISCARD constexpr T min(const T& a, const T& b) noexcept {
 template <typename T>
 DAXE_NODISCARD DAXE_ALWAYS_INLINE Option<T> min(const std::vector<T>& v) {
     if (v.empty()) return None;
-    return Some(*std::min_element(v.begin(), v.end()));
+    return Some(detail::minof(v));
 }
 
 // min - vector with fallback
 template <typename T>
 DAXE_NODISCARD DAXE_ALWAYS_INLINE T min(const std::vector<T>& v, const T& fallback) {
     if (v.empty()) return fallback;
-    return *std::min_element(v.begin(), v.end());
+    return detail::minof(v);
 }
 
 // min - any other container (fallback) - Safe by default
@@ -118,42 +121,41 @@ DAXE_NODISCARD inline auto min(const Container& c) -> Option<typename Container:
 template <typename T>
 DAXE_NODISCARD inline Option<std::pair<T, T>> minmax(const std::vector<T>& v) {
     if (v.empty()) return None;
-    auto [minit, maxit] = std::minmax_element(v.begin(), v.end());
-    return Some(std::make_pair(*minit, *maxit));
+    return Some(detail::minmaxof(v));
 }
 
 // argmax - index of maximum element - Safe by default
 template <typename T>
 DAXE_NODISCARD inline Option<i64> argmax(const std::vector<T>& v) {
     if (v.empty()) return None;
-    return Some(static_cast<i64>(std::max_element(v.begin(), v.end()) - v.begin()));
+    return Some(detail::argmaxof(v));
 }
 
 // argmax with fallback
 template <typename T>
 DAXE_NODISCARD inline i64 argmax(const std::vector<T>& v, i64 fallback) {
     if (v.empty()) return fallback;
-    return static_cast<i64>(std::max_element(v.begin(), v.end()) - v.begin());
+    return detail::argmaxof(v);
 }
 
 // argmin - index of minimum element - Safe by default
 template <typename T>
 DAXE_NODISCARD inline Option<i64> argmin(const std::vector<T>& v) {
     if (v.empty()) return None;
-    return Some(static_cast<i64>(std::min_element(v.begin(), v.end()) - v.begin()));
+    return Some(detail::argminof(v));
 }
 
 // argmin with fallback
 template <typename T>
 DAXE_NODISCARD inline i64 argmin(const std::vector<T>& v, i64 fallback) {
     if (v.empty()) return fallback;
-    return static_cast<i64>(std::min_element(v.begin(), v.end()) - v.begin());
+    return detail::argminof(v);
 }
 
 // sum - vector (optimized, no SFINAE overhead)
 template <typename T>
 DAXE_NODISCARD DAXE_ALWAYS_INLINE auto sum(const std::vector<T>& v) noexcept -> T {
-    return std::accumulate(v.begin(), v.end(), T{});
+    return detail::sumof(v);
 }
 
 // sum - any other container (fallback)
@@ -181,25 +183,67 @@ DAXE_NODISCARD inline vi64 iota(i64 count, i64 start = 0) {
     return result;
 }
 
-// prefixsum - cumulative sum from left
+// prefixsum - cumulative sum from left (SIMD for i32 / i64)
 template <typename T>
 DAXE_NODISCARD inline std::vector<T> prefixsum(const std::vector<T>& v) {
     std::vector<T> result(v.size());
-    if (!v.empty()) {
-        result[0] = v[0];
-        for (size_t i = 1; i < v.size(); ++i) result[i] = result[i-1] + v[i];
-    }
+    detail::prefixsumrange(v.data(), result.data(), v.size());
     return result;
 }
 
+// prefixsuminplace - prefixsum without the copy
+template <typename T>
+inline void prefixsuminplace(std::vector<T>& v) {
+    detail::prefixsumrange(v.data(), v.data(), v.size());
+}
+
+// suffixsuminplace - cumulative sum from right, in place
+template <typename T>
+inline void suffixsuminplace(std::vector<T>& v) {
+    for (size_t i = v.size() - (v.empty() ? 0 : 1); i-- > 0;) v[i] = v[i+1] + v[i];
+}
+
 // suffixsum - cumulative sum from right
 template <typename T>
 DAXE_NODISCARD inline std::vector<T> suffixsum(const std::vector<T>& v) {
-    std::vector<T> result(v.size());
-    if (!v.empty()) {
-        result[v.size()-1] = v[v.size()-1];
-        for (size_t i = v.size()-1; i-- > 0;) result[i] = result[i+1] + v[i];
+    std::vector<T> result(v);
+    suffixsuminplace(result);
+    return result;
+}
+
+// inclusivescaninplace - v[i] = v[0] op v[1] op ... op v[i], op associative
+template <typename T, typename Op = std::plus<T>>
+inline void inclusivescaninplace(std::vector<T>& v, Op op = Op{}) {
+    if constexpr (std::is_same_v<Op, std::plus<T>> || std::is_same_v<Op, std::plus<>>) {
+        detail::prefixsumrange(v.data(), v.data(), v.size());
+    } else {
+        for (size_t i = 1; i < v.size(); ++i) v[i] = op(v[i-1], v[i]);
+    }
+}
+
+// inclusivescan - copying version
+template <typename T, typename Op = std::plus<T>>
+DAXE_NODISCARD inline std::vector<T> inclusivescan(const std::vector<T>& v, Op op = Op{}) {
+    std::vector<T> result(v);
+    inclusivescaninplace(result, op);
+    return result;
+}
+
+// exclusivescaninplace - v[0] = init, v[i] = init op v[0] op ... op v[i-1]
+template <typename T, typename Op = std::plus<T>>
+inline void exclusivescaninplace(std::vector<T>& v, T init = T{}, Op op = Op{}) {
+    for (auto& x : v) {
+        T next = op(init, x);
+        x = std::move(init);
+        init = std::move(next);
     }
+}
+
+// exclusivescan - copying version
+template <typename T, typename Op = std::plus<T>>
+DAXE_NODISCARD inline std::vector<T> exclusivescan(const std::vector<T>& v, T init = T{}, Op op = Op{}) {
+    std::vector<T> result(v);
+    exclusivescaninplace(result, std::move(init), op);
     return result;
 }
 
@@ -228,6 +272,14 @@ DAXE_NODISCARD inline std::vector<T> differences(const std::vector<T>& v) {
     return pairwise(v, [](const T& a, const T& b) { return b - a; });
 }
 
+// differencesinplace - v becomes differences(v), one element shorter
+template <typename T>
+inline void differencesinplace(std::vector<T>& v) {
+    if (v.empty()) return;
+    for (size_t i = 0; i + 1 < v.size(); ++i) v[i] = v[i+1] - v[i];
+    v.pop_back();
+}
+
 // first - any container
 #if DAXE_HAS_CONCEPTS
 template <typename Container>
@@ -255,7 +307,7 @@ DAXE_NODISCARD inline auto last(const Container& c) ->
 // has - vector (optimized, no SFINAE overhead)
 template <typename T>
 DAXE_NODISCARD DAXE_ALWAYS_INLINE bool has(const std::vector<T>& v, const T& x) noexcept {
-    return std::find(v.begin(), v.end(), x) != v.end();
+    return detail::findin(v, x) != v.size();
 }
 
 // has - any other container (fallback)
@@ -263,7 +315,8 @@ template <typename Container, typename T, typename = std::enable_if_t<
     detail::is_iterable_v<Container> &&
     !std::is_same_v<Container, std::vector<T>>>>
 DAXE_NODISCARD inline bool has(const Container& c, const T& x) noexcept {
-    return std::find(std::begin(c), std::end(c), x) != std::end(c);
+    if constexpr (detail::hasdata<const Container>::value) return detail::findin(c, x) != std::size(c);
+    else return std::find(std::begin(c), std::end(c), x) != std::end(c);
 }
 
 // Optimized has for set/map (O(log n))
@@ -312,7 +365,7 @@ DAXE_NODISCARD inline bool none(const Container& c, Pred&& pred) {
 // count(container, value) -> occurrences
 template <typename Container, typename T>
 DAXE_NODISCARD inline i64 count(const Container& c, const T& value) {
-    return static_cast<i64>(std::count(std::begin(c), std::end(c), value));
+    return static_cast<i64>(detail::countin(c, value));
 }
 
 // ==========================================
@@ -320,7 +373,7 @@ DAXE_NODISCARD inline i64 count(const Container& c, const T& value) {
 // ==========================================
 template <typename T>
 DAXE_NODISCARD inline std::vector<T> sorted(std::vector<T> v) {
-    std::sort(v.begin(), v.end());
+    detail::sortrange(v.data(), v.size());
     return v;
 }
 
@@ -372,12 +425,7 @@ DAXE_NODISCARD inline std::vector<T> filtered(const std::vector<T>& v, Pred&& pr
 
 template <typename T>
 DAXE_NODISCARD inline std::vector<T> sliced(const std::vector<T>& v, i64 start, i64 end) {
-    const i64 n = static_cast<i64>(v.size());
-    if (start < 0) start += n;
-    if (end < 0) end += n;
-    start = std::max(0LL, std::min(start, n));
-    end = std::max(0LL, std::min(end, n));
-    if (start >= end) DAXE_UNLIKELY return {};
+    if (!detail::normalizeslice(start, end, static_cast<i64>(v.size()))) DAXE_UNLIKELY return {};
     return std::vector<T>(v.begin() + start, v.begin() + end);
 }
 
@@ -444,21 +492,57 @@ DAXE_NODISCARD inline std::vector<str> split(const str& s, char d) {
     return split(s, str(1, d));
 }
 
-DAXE_NODISCARD inline str join(const std::vector<str>& v, const str& sep = " ") {
-    if (v.empty()) DAXE_UNLIKELY return "";
-    str r = v[0];
-    for (size_t i = 1; i < v.size(); ++i) { r += sep; r += v[i]; }
-    return r;
+namespace detail {
+    template <typename It>
+    DAXE_NODISCARD inline str joinrange(It first, It last, strview sep) {
+        if (first == last) DAXE_UNLIKELY return "";
+        size_t total = 0, parts = 0;
+        for (It it = first; it != last; ++it, ++parts) total += strview(*it).size();
+        str r;
+        r.reserve(total + (parts - 1) * sep.size());
+        r += strview(*first);
+        for (++first; first != last; ++first) { r += sep; r += strview(*first); }
+        return r;
+    }
 }
 
-DAXE_NODISCARD inline str lowercase(str s) noexcept {
-    for (auto& c : s) c = static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
-    return s;
+// join(v, sep) - output size is computed first, so the result allocates once
+DAXE_NODISCARD inline str join(const std::vector<str>& v, strview sep = " ") {
+    return detail::joinrange(v.begin(), v.end(), sep);
 }
 
-DAXE_NODISCARD inline str uppercase(str s) noexcept {
-    for (auto& c : s) c = static_cast<char>(std::toupper(static_cast<unsigned char>(c)));
-    return s;
+// join over any other container of string-likes (strview, const char*, ...)
+namespace detail {
+    template <typename Container>
+    inline constexpr bool isstringrange = !std::is_same_v<Container, std::vector<str>> &&
+        std::is_convertible_v<decltype(*std::begin(std::declval<const Container&>())), strview>;
+}
+
+#if DAXE_HAS_CONCEPTS
+template <typename Container>
+requires detail::isstringrange<Container>
+#else
+template <typename Container, typename = std::enable_if_t<detail::isstringrange<Container>>>
+#endif
+DAXE_NODISCARD inline str join(const Container& v, strview sep = " ") {
+    return detail::joinrange(std::begin(v), std::end(v), sep);
+}
+
+// Case mapping, the is* predicates and strip scan ASCII a vector at a time;
+// bytes >= 0x80 go through <cctype>, so results match the std:: functions.
+inline void lowercaseinplace(str& s) noexcept { detail::asciicase<false>(s.data(), s.data(), s.size()); }
+inline void uppercaseinplace(str& s) noexcept { detail::asciicase<true>(s.data(), s.data(), s.size()); }
+
+DAXE_NODISCARD inline str lowercase(strview s) {
+    str r(s.size(), '\0');
+    detail::asciicase<false>(s.data(), r.data(), s.size());
+    return r;
+}
+
+DAXE_NODISCARD inline str uppercase(strview s) {
+    str r(s.size(), '\0');
+    detail::asciicase<true>(s.data(), r.data(), s.size());
+    return r;
 }
 
 DAXE_NODISCARD inline bool startswith(const str& s, const str& prefix) noexcept {
@@ -469,24 +553,19 @@ DAXE_NODISCARD inline bool endswith(const str& s, const str& suffix) noexcept {
     return s.size() >= suffix.size() && s.compare(s.size() - suffix.size(), suffix.size(), suffix) == 0;
 }
 
-DAXE_NODISCARD inline str strip(str s) {
-    const auto start = s.find_first_not_of(" \t\n\r");
-    if (start == str::npos) return "";
-    const auto end = s.find_last_not_of(" \t\n\r");
-    return s.substr(start, end - start + 1);
-}
+// strip family removes ' ', '\t', '\n', '\r'. The *view forms return a view
+// into s (no copy), the *inplace forms erase from s.
+DAXE_NODISCARD inline strview lstripview(strview s) noexcept { return s.substr(detail::skipstrip(s.data(), s.size())); }
+DAXE_NODISCARD inline strview rstripview(strview s) noexcept { return s.substr(0, detail::skipstripback(s.data(), s.size())); }
+DAXE_NODISCARD inline strview stripview(strview s) noexcept { return rstripview(lstripview(s)); }
 
-DAXE_NODISCARD inline str lstrip(str s) {
-    const auto start = s.find_first_not_of(" \t\n\r");
-    if (start == str::npos) return "";
-    return s.substr(start);
-}
+DAXE_NODISCARD inline str strip(strview s) { return str(stripview(s)); }
+DAXE_NODISCARD inline str lstrip(strview s) { return str(lstripview(s)); }
+DAXE_NODISCARD inline str rstrip(strview s) { return str(rstripview(s)); }
 
-DAXE_NODISCARD inline str rstrip(str s) {
-    const auto end = s.find_last_not_of(" \t\n\r");
-    if (end == str::npos) return "";
-    return s.substr(0, end + 1);
-}
+inline void rstripinplace(str& s) noexcept { s.resize(detail::skipstripback(s.data(), s.size())); }
+inline void lstripinplace(str& s) noexcept { s.erase(0, detail::skipstrip(s.data(), s.size())); }
+inline void stripinplace(str& s) noexcept { rstripinplace(s); lstripinplace(s); }
 
 DAXE_NODISCARD inline str repeatstr(const str& s, i64 n) {
     str result;
@@ -495,19 +574,29 @@ DAXE_NODISCARD inline str repeatstr(const str& s, i64 n) {
     return result;
 }
 
-DAXE_NODISCARD inline str replace(str s, const str& old_val, const str& new_val) {
-    if (old_val.empty()) return s;
-    size_t start = 0;
-    while ((start = s.find(old_val, start)) != str::npos) {
-        s.replace(start, old_val.length(), new_val);
-        start += new_val.length();
+// replace(s, from, to) - every non-overlapping from, left to right, found
+// in O(n + m). Matches are located first, so the result is sized exactly
+// and built in one pass.
+DAXE_NODISCARD inline str replace(strview s, strview from, strview to) {
+    if (from.empty()) return str(s);
+    std::vector<size_t> hits;
+    detail::matcheach(s, from, false, [&](size_t at) { hits.push_back(at); return true; });
+    if (hits.empty()) return str(s);
+    str r;
+    r.reserve(s.size() - hits.size() * from.size() + hits.size() * to.size());
+    size_t copied = 0;
+    for (size_t at : hits) {
+        r.append(s.substr(copied, at - copied));
+        r.append(to);
+        copied = at + from.size();
     }
-    return s;
+    r.append(s.substr(copied));
+    return r;
 }
 
 // Substring check
-DAXE_NODISCARD inline bool has(const str& s, const str& sub) noexcept {
-    return s.find(sub) != str::npos;
+DAXE_NODISCARD inline bool has(const str& s, const str& sub) {
+    return detail::linearfind(s, sub) != strview::npos;
 }
 
 DAXE_NODISCARD inline bool has(const str& s, char c) noexcept {
@@ -515,43 +604,46 @@ DAXE_NODISCARD inline bool has(const str& s, char c) noexcept {
 }
 
 // String predicates
-DAXE_NODISCARD inline bool isalpha(const str& s) noexcept {
-    if (s.empty()) return false;
-    for (char c : s) if (!std::isalpha(static_cast<unsigned char>(c))) return false;
-    return true;
+DAXE_NODISCARD inline bool isalpha(strview s) noexcept {
+    return !s.empty() && detail::asciiall<detail::ASCII_ALPHA>(s.data(), s.size());
 }
 
-DAXE_NODISCARD inline bool isdigit(const str& s) noexcept {
-    if (s.empty()) return false;
-    for (char c : s) if (!std::isdigit(static_cast<unsigned char>(c))) return false;
-    return true;
+DAXE_NODISCARD inline bool isdigit(strview s) noexcept {
+    return !s.empty() && detail::asciiall<detail::ASCII_DIGIT>(s.data(), s.size());
 }
 
-DAXE_NODISCARD inline bool isalnum(const str& s) noexcept {
-    if (s.empty()) return false;
-    for (char c : s) if (!std::isalnum(static_cast<unsigned char>(c))) return false;
-    return true;
+DAXE_NODISCARD inline bool isalnum(strview s) noexcept {
+    return !s.empty() && detail::asciiall<detail::ASCII_ALNUM>(s.data(), s.size());
 }
 
 // capitalize - first letter uppercase, rest lowercase
-DAXE_NODISCARD inline str capitalize(str s) noexcept {
-    if (!s.empty()) {
-        s[0] = static_cast<char>(std::toupper(static_cast<unsigned char>(s[0])));
-        for (size_t i = 1; i < s.size(); ++i) 
-            s[i] = static_cast<char>(std::tolower(static_cast<unsigned char>(s[i])));
-    }
-    return s;
+inline void capitalizeinplace(str& s) noexcept {
+    if (s.empty()) return;
+    const char first = s[0];
+    lowercaseinplace(s);
+    s[0] = detail::casebyte<true>(first);
+}
+
+DAXE_NODISCARD inline str capitalize(strview s) {
+    str r(s);
+    capitalizeinplace(r);
+    return r;
 }
 
 // title - capitalize first letter of each word
-DAXE_NODISCARD inline str title(str s) noexcept {
+inline void titleinplace(str& s) noexcept {
+    lowercaseinplace(s);
     bool newword = true;
     for (char& c : s) {
-        if (std::isspace(static_cast<unsigned char>(c))) newword = true;
-        else if (newword) { c = static_cast<char>(std::toupper(static_cast<unsigned char>(c))); newword = false; }
-        else c = static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+        if (detail::spacebyte(c)) newword = true;
+        else if (newword) { c = detail::casebyte<true>(c); newword = false; }
     }
-    return s;
+}
+
+DAXE_NODISCARD inline str title(strview s) {
+    str r(s);
+    titleinplace(r);
+    return r;
 }
 
 // center - pad string to width with fill char
@@ -2,7 +2,7 @@
  * DAXE - GRAPH UTILITIES
  * D.A's Axe - Cut through C++ verbosity
  * 
- * Common graph data structures and helpers
+ * Common graph data structures and helpers, plus FenwickTree, RangeMin and DSU
  */
 
 #ifndef DAXE_GRAPH_H
@@ -10,6 +10,8 @@
 
 #include "base.h"
 #include "macros.h"
+#include "math.h"
+#include <algorithm>
 #include <vector>
 #include <queue>
 #include <numeric>
@@ -119,6 +121,66 @@ public:
     }
 };
 
+// ==========================================
+// RANGE MINIMUM (STATIC)
+// ==========================================
+// O(1) min over [l, r] in O(n) memory: a sparse table over 64-element block
+// minima, and inside a block a bitmask per position marking the running
+// suffix minima, so the answer is the lowest marked bit at or after l.
+template <typename T = i64>
+class RangeMin {
+    std::vector<T> data;
+    std::vector<u64> mask;
+    std::vector<std::vector<T>> table;   // table[k][b] = min of blocks b .. b + 2^k - 1
+
+    DAXE_NODISCARD T inblock(size_t l, size_t r) const {
+        const u64 m = mask[r] & (~u64{0} << (l & 63));
+        return data[(r & ~size_t{63}) + static_cast<size_t>(trailingzeros(m))];
+    }
+
+public:
+    RangeMin() = default;
+    explicit RangeMin(std::vector<T> v) : data(std::move(v)), mask(data.size()) {
+        const size_t n = data.size(), blocks = (n + 63) / 64;
+        for (size_t start = 0; start < n; start += 64) {
+            u64 live = 0;
+            for (size_t i = start; i < std::min(n, start + 64); ++i) {
+                // drop marked positions whose value exceeds data[i]
+                while (live) {
+                    const size_t top = start + 63 - static_cast<size_t>(leadingzeros(live));
+                    if (!(data[i] < data[top])) break;
+                    live &= ~(u64{1} << (top - start));
+                }
+                live |= u64{1} << (i - start);
+                mask[i] = live;
+            }
+        }
+        table.emplace_back(blocks);
+        for (size_t b = 0; b < blocks; ++b) table[0][b] = inblock(b * 64, std::min(n, b * 64 + 64) - 1);
+        for (size_t k = 1; (size_t{1} << k) <= blocks; ++k) {
+            const auto& prev = table[k - 1];
+            std::vector<T> cur(blocks - (size_t{1} << k) + 1);
+            for (size_t b = 0; b < cur.size(); ++b) cur[b] = std::min(prev[b], prev[b + (size_t{1} << (k - 1))]);
+            table.push_back(std::move(cur));
+        }
+    }
+
+    // query(l, r) -> min of [l, r], inclusive; needs 0 <= l <= r < size()
+    DAXE_NODISCARD T query(i64 l, i64 r) const {
+        const size_t lo = static_cast<size_t>(l), hi = static_cast<size_t>(r);
+        const size_t bl = lo / 64, br = hi / 64;
+        if (bl == br) return inblock(lo, hi);
+        T best = std::min(inblock(lo, bl * 64 + 63), inblock(br * 64, hi));
+        if (bl + 1 < br) {
+            const size_t k = static_cast<size_t>(highestbit(br - bl - 1));
+            best = std::min({best, table[k][bl + 1], table[k][br - (size_t{1} << k)]});
+        }
+        return best;
+    }
+
+    DAXE_NODISCARD i64 size() const noexcept { return static_cast<i64>(data.size()); }
+};
+
 // ==========================================
 // DISJOINT SET UNION (UNION-FIND)
 // ==========================================
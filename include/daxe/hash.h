@@ -0,0 +1,192 @@
+/*
+ * DAXE - HASHING
+ * D.A's Axe - Cut through C++ verbosity
+ *
+ * Hash - one hasher for integers, floats, strings, pairs, tuples, arrays
+ * and vectors, seeded once per process so inputs cannot be tuned against
+ * it. Integers go through the splitmix64 finalizer, bytes through a
+ * wyhash-style loop; composite keys fold their members in order. Types
+ * with a std::hash specialization are accepted too.
+ *
+ *   std::unordered_map<pi64, i64, Hash> seen;
+ *
+ * Naming: Flat style (no snake_case)
+ */
+
+#ifndef DAXE_HASH_H
+#define DAXE_HASH_H
+
+#include "base.h"
+#include <array>
+#include <chrono>
+#include <cstring>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+DAXE_NAMESPACE_BEGIN
+
+namespace detail {
+    // splitmix64 finalizer. std::hash is the identity for integers on the
+    // common standard libraries, which linear probing cannot tolerate.
+    DAXE_NODISCARD constexpr u64 mixhash(u64 h) noexcept {
+        h ^= h >> 30; h *= 0xbf58476d1ce4e5b9ULL;
+        h ^= h >> 27; h *= 0x94d049bb133111ebULL;
+        return h ^ (h >> 31);
+    }
+
+    inline constexpr u64 WYP0 = 0xa0761d6478bd642fULL;
+    inline constexpr u64 WYP1 = 0xe7037ed1a0b428dbULL;
+    inline constexpr u64 WYP2 = 0x8ebc6af09c88c6e3ULL;
+    inline constexpr u64 WYP3 = 0x589965cc75374cc3ULL;
+
+    // 64x64 -> 128 multiply, folded: low half xor high half
+    DAXE_NODISCARD DAXE_ALWAYS_INLINE u64 wymix(u64 a, u64 b) noexcept {
+#if DAXE_HAS_INT128
+        const u128 r = static_cast<u128>(a) * b;
+        return static_cast<u64>(r) ^ static_cast<u64>(r >> 64);
+#else
+        const u64 al = a & 0xFFFFFFFFULL, ah = a >> 32, bl = b & 0xFFFFFFFFULL, bh = b >> 32;
+        const u64 ll = al * bl, lh = al * bh, hl = ah * bl, hh = ah * bh;
+        const u64 mid = (ll >> 32) + (lh & 0xFFFFFFFFULL) + (hl & 0xFFFFFFFFULL);
+        const u64 lo = (ll & 0xFFFFFFFFULL) | (mid << 32);
+        const u64 hi = hh + (lh >> 32) + (hl >> 32) + (mid >> 32);
+        return lo ^ hi;
+#endif
+    }
+
+    // Drawn once per process from the clock and the address space layout
+    DAXE_NODISCARD inline u64 hashseed() noexcept {
+        static const u64 seed = [] {
+            static int anchor;
+            const u64 t = static_cast<u64>(std::chrono::steady_clock::now().time_since_epoch().count());
+            return mixhash(t ^ mixhash(reinterpret_cast<std::uintptr_t>(&anchor)));
+        }();
+        return seed;
+    }
+
+    DAXE_NODISCARD DAXE_ALWAYS_INLINE u64 read8(const char* p) noexcept { u64 v; std::memcpy(&v, p, 8); return v; }
+    DAXE_NODISCARD DAXE_ALWAYS_INLINE u64 read4(const char* p) noexcept { u32 v; std::memcpy(&v, p, 4); return v; }
+
+    DAXE_NODISCARD inline u64 hashbytes(const char* p, size_t n, u64 seed) noexcept {
+        seed ^= wymix(seed ^ WYP0, WYP1);
+        u64 a = 0, b = 0;
+        if (n <= 16) {
+            if (n >= 4) {
+                const size_t off = (n >> 3) << 2;
+                a = (read4(p) << 32) | read4(p + off);
+                b = (read4(p + n - 4) << 32) | read4(p + n - 4 - off);
+            } else if (n > 0) {
+                a = (static_cast<u64>(static_cast<u8>(p[0])) << 16) | (static_cast<u64>(static_cast<u8>(p[n >> 1])) << 8) | static_cast<u8>(p[n - 1]);
+            }
+        } else {
+            size_t i = n;
+            if (i > 48) {
+                u64 s1 = seed, s2 = seed;
+                do {
+                    seed = wymix(read8(p) ^ WYP1, read8(p + 8) ^ seed);
+                    s1 = wymix(read8(p + 16) ^ WYP2, read8(p + 24) ^ s1);
+                    s2 = wymix(read8(p + 32) ^ WYP3, read8(p + 40) ^ s2);
+                    p += 48;
+                    i -= 48;
+                } while (i > 48);
+                seed ^= s1 ^ s2;
+            }
+            while (i > 16) {
+                seed = wymix(read8(p) ^ WYP1, read8(p + 8) ^ seed);
+                p += 16;
+                i -= 16;
+            }
+            a = read8(p + i - 16);
+            b = read8(p + i - 8);
+        }
+        // The seed goes into both halves: otherwise a == WYP1 zeroes the inner
+        // mix and those inputs all hash to the same value under every seed
+        return wymix(WYP1 ^ n, wymix(a ^ WYP1 ^ seed, b ^ seed));
+    }
+
+    // Order-dependent fold for composite keys
+    DAXE_NODISCARD DAXE_ALWAYS_INLINE u64 hashcombine(u64 h, u64 v) noexcept { return wymix(h ^ v, WYP0); }
+
+    template <typename T> struct isvector : std::false_type {};
+    template <typename T, typename A> struct isvector<std::vector<T, A>> : std::true_type {};
+    template <typename T> struct isstdarray : std::false_type {};
+    template <typename T, size_t N> struct isstdarray<std::array<T, N>> : std::true_type {};
+    template <typename T> struct ispair : std::false_type {};
+    template <typename A, typename B> struct ispair<std::pair<A, B>> : std::true_type {};
+    template <typename T> struct istuple : std::false_type {};
+    template <typename... Ts> struct istuple<std::tuple<Ts...>> : std::true_type {};
+
+    template <typename T>
+    DAXE_NODISCARD inline u64 hashvalue(const T& x, u64 seed) noexcept;
+
+    template <typename Range>
+    DAXE_NODISCARD inline u64 hashrange(const Range& r, u64 seed) noexcept {
+        using E = std::decay_t<decltype(*std::begin(r))>;
+        if constexpr (std::is_integral_v<E> && sizeof(E) == 1 && !std::is_same_v<E, bool>) {
+            return hashbytes(reinterpret_cast<const char*>(r.data()), r.size(), seed);
+        } else {
+            u64 h = seed ^ r.size();
+            for (const auto& x : r) h = hashcombine(h, hashvalue(x, seed));
+            return h;
+        }
+    }
+
+    template <typename T>
+    DAXE_NODISCARD inline u64 hashvalue(const T& x, u64 seed) noexcept {
+        if constexpr (std::is_integral_v<T> || std::is_enum_v<T>) {
+            return mixhash(static_cast<u64>(x) ^ seed);
+#if DAXE_HAS_INT128
+        } else if constexpr (std::is_same_v<T, i128> || std::is_same_v<T, u128>) {
+            const u128 u = static_cast<u128>(x);
+            return hashcombine(mixhash(static_cast<u64>(u) ^ seed), static_cast<u64>(u >> 64));
+#endif
+        } else if constexpr (std::is_floating_point_v<T>) {
+            const f64 d = x == 0 ? 0.0 : static_cast<f64>(x);   // -0.0 == 0.0
+            u64 bits;
+            std::memcpy(&bits, &d, sizeof bits);
+            return mixhash(bits ^ seed);
+        } else if constexpr (std::is_convertible_v<const T&, strview>) {
+            const strview s = x;
+            return hashbytes(s.data(), s.size(), seed);
+        } else if constexpr (ispair<T>::value) {
+            return hashcombine(hashcombine(seed, hashvalue(x.first, seed)), hashvalue(x.second, seed));
+        } else if constexpr (istuple<T>::value) {
+            u64 h = seed;
+            std::apply([&](const auto&... e) { ((h = hashcombine(h, hashvalue(e, seed))), ...); }, x);
+            return h;
+        } else if constexpr (isvector<T>::value || isstdarray<T>::value) {
+            return hashrange(x, seed);
+        } else if constexpr (std::is_pointer_v<T>) {
+            return mixhash(static_cast<u64>(reinterpret_cast<std::uintptr_t>(x)) ^ seed);
+        } else {
+            return mixhash(static_cast<u64>(std::hash<T>{}(x)) ^ seed);
+        }
+    }
+}
+
+// ==========================================
+// HASH
+// ==========================================
+// Equal keys hash equally across str, strview and const char*, so string
+// tables can be probed with a view. Seeded per process, so iteration order
+// of hashed containers differs between runs; each hasher keeps a copy of
+// the seed so hot loops never reload it.
+struct Hash {
+    using is_transparent = void;
+
+    u64 seed = detail::hashseed();
+
+    template <typename T>
+    DAXE_NODISCARD size_t operator()(const T& x) const noexcept {
+        return static_cast<size_t>(detail::hashvalue(x, seed));
+    }
+};
+
+DAXE_NAMESPACE_END
+
+#endif // DAXE_HASH_H
@@ -0,0 +1,440 @@
+/*
+ * DAXE - FLAT HASH TABLES
+ * D.A's Axe - Cut through C++ verbosity
+ *
+ * HashSet<T> - open addressing, linear probing, one control byte per slot.
+ * No per-element allocation, so inserts and lookups stay in a few cache lines.
+ * HashDict<K, V> - the same table holding (key, value) pairs, with the
+ * method names of Dict.
+ *
+ * Naming: Flat style (no snake_case)
+ */
+
+#ifndef DAXE_HASHTABLE_H
+#define DAXE_HASHTABLE_H
+
+#include "base.h"
+#include "hash.h"
+#include "math.h"
+#include "safe.h"
+#include "pythonic.h"
+#include <cstring>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#if DAXE_SIMD_AVX2
+    #include <emmintrin.h>
+#elif DAXE_SIMD_NEON
+    #include <arm_neon.h>
+#endif
+
+DAXE_NAMESPACE_BEGIN
+
+namespace detail {
+    struct SelfKey {
+        template <typename T>
+        DAXE_NODISCARD constexpr const T& operator()(const T& x) const noexcept { return x; }
+    };
+
+    struct FirstKey {
+        template <typename P>
+        DAXE_NODISCARD constexpr const auto& operator()(const P& p) const noexcept { return p.first; }
+    };
+
+    // ==========================================
+    // CONTROL GROUPS
+    // ==========================================
+    inline constexpr size_t CTRLGROUP = 16;
+
+    // Bit k set where ctrl[k] == b, k in [0, 16). SSE2 is part of x86-64.
+    DAXE_NODISCARD DAXE_ALWAYS_INLINE u32 matchctrl(const u8* ctrl, u8 b) noexcept {
+#if DAXE_SIMD_AVX2
+        const __m128i g = _mm_loadu_si128(reinterpret_cast<const __m128i*>(ctrl));
+        return static_cast<u32>(_mm_movemask_epi8(_mm_cmpeq_epi8(g, _mm_set1_epi8(static_cast<char>(b)))));
+#elif DAXE_SIMD_NEON
+        // Narrow each 0x00/0xFF lane to a nibble, then gather one bit per lane
+        const uint8x16_t eq = vceqq_u8(vld1q_u8(ctrl), vdupq_n_u8(b));
+        u64 nib = vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(eq), 4)), 0);
+        nib &= 0x1111111111111111ULL;
+        u32 m = 0;
+        for (u32 k = 0; nib; ++k, nib >>= 4) m |= static_cast<u32>(nib & 1) << k;
+        return m;
+#else
+        u32 m = 0;
+        for (u32 k = 0; k < CTRLGROUP; ++k) m |= static_cast<u32>(ctrl[k] == b) << k;
+        return m;
+#endif
+    }
+
+    // ==========================================
+    // FLAT TABLE
+    // ==========================================
+    // Entries live in one array; ctrl_[i] is 0 for an empty slot, otherwise
+    // 0x80 | the top 7 hash bits, so most mismatches never touch the entry.
+    // Probing is linear, but tests 16 control bytes per step; the first 15
+    // are mirrored past the end so a group never wraps. KeyOf maps an entry
+    // to its key (SelfKey for sets). Erase shifts the following run back, so
+    // there are no tombstones. Max load is 3/4.
+    template <typename Entry, typename KeyOf = SelfKey, typename Hasher = Hash, typename Eq = std::equal_to<>>
+    class FlatTable {
+        u8* ctrl_ = nullptr;
+        Entry* slots_ = nullptr;
+        size_t mask_ = 0;
+        size_t size_ = 0;
+        KeyOf keyof_;
+        Hasher hash_;
+        Eq eq_;
+
+        DAXE_NODISCARD size_t capacity() const noexcept { return slots_ ? mask_ + 1 : 0; }
+        DAXE_NODISCARD static constexpr u8 fingerprint(size_t h) noexcept { return static_cast<u8>(0x80 | (static_cast<u64>(h) >> 57)); }
+        DAXE_NODISCARD static constexpr size_t ctrlbytes(size_t cap) noexcept { return cap + CTRLGROUP - 1; }
+
+        void setctrl(size_t i, u8 c) noexcept {
+            ctrl_[i] = c;
+            if (i < CTRLGROUP - 1) ctrl_[mask_ + 1 + i] = c;
+        }
+
+        // First empty slot at or after the home of h
+        DAXE_NODISCARD size_t emptyslot(size_t h) const noexcept {
+            for (size_t i = h & mask_;; i = (i + CTRLGROUP) & mask_) {
+                if (const u32 e = matchctrl(ctrl_ + i, 0)) return (i + static_cast<size_t>(trailingzeros(e))) & mask_;
+            }
+        }
+
+        static constexpr size_t NOSLOT = ~size_t{0};
+
+        // Slot index holding key, or NOSLOT
+        template <typename K>
+        DAXE_NODISCARD size_t slotof(const K& key) const {
+            if (!slots_) return NOSLOT;
+            const size_t h = hash_(key);
+            const u8 fp = fingerprint(h);
+            for (size_t i = h & mask_;; i = (i + CTRLGROUP) & mask_) {
+                const u32 empty = matchctrl(ctrl_ + i, 0);
+                // The run ends at the first empty slot; later matches belong to other runs
+                u32 hit = matchctrl(ctrl_ + i, fp) & ((empty & (0 - empty)) - 1);
+                for (; hit; hit &= hit - 1) {
+                    const size_t j = (i + static_cast<size_t>(trailingzeros(hit))) & mask_;
+                    if (eq_(keyof_(slots_[j]), key)) DAXE_LIKELY return j;
+                }
+                if (empty) return NOSLOT;
+            }
+        }
+
+        void release() noexcept {
+            if (!slots_) return;
+            for (size_t i = 0; i <= mask_; ++i) if (ctrl_[i]) slots_[i].~Entry();
+            std::allocator<Entry>().deallocate(slots_, mask_ + 1);
+            delete[] ctrl_;
+            ctrl_ = nullptr; slots_ = nullptr; mask_ = 0; size_ = 0;
+        }
+
+        void rehash(size_t cap) {
+            u8* oldctrl = ctrl_;
+            Entry* oldslots = slots_;
+            const size_t oldcap = capacity();
+            ctrl_ = new u8[ctrlbytes(cap)]();
+            slots_ = std::allocator<Entry>().allocate(cap);
+            mask_ = cap - 1;
+            for (size_t i = 0; i < oldcap; ++i) {
+                if (!oldctrl[i]) continue;
+                const size_t h = hash_(keyof_(oldslots[i]));
+                const size_t j = emptyslot(h);
+                setctrl(j, fingerprint(h));
+                ::new (static_cast<void*>(slots_ + j)) Entry(std::move(oldslots[i]));
+                oldslots[i].~Entry();
+            }
+            if (oldslots) std::allocator<Entry>().deallocate(oldslots, oldcap);
+            delete[] oldctrl;
+        }
+
+        void grow() { rehash(capacity() ? capacity() * 2 : 16); }
+
+    public:
+        FlatTable() = default;
+        explicit FlatTable(KeyOf keyof, Hasher hash = Hasher{}, Eq eq = Eq{}) : keyof_(std::move(keyof)), hash_(std::move(hash)), eq_(std::move(eq)) {}
+        FlatTable(const FlatTable& o) : keyof_(o.keyof_), hash_(o.hash_), eq_(o.eq_) {
+            if (!o.slots_) return;
+            ctrl_ = new u8[ctrlbytes(o.mask_ + 1)];
+            std::memcpy(ctrl_, o.ctrl_, ctrlbytes(o.mask_ + 1));
+            slots_ = std::allocator<Entry>().allocate(o.mask_ + 1);
+            mask_ = o.mask_;
+            for (size_t i = 0; i <= mask_; ++i) if (ctrl_[i]) ::new (static_cast<void*>(slots_ + i)) Entry(o.slots_[i]);
+            size_ = o.size_;
+        }
+        FlatTable(FlatTable&& o) noexcept
+            : ctrl_(o.ctrl_), slots_(o.slots_), mask_(o.mask_), size_(o.size_),
+              keyof_(std::move(o.keyof_)), hash_(std::move(o.hash_)), eq_(std::move(o.eq_)) {
+            o.ctrl_ = nullptr; o.slots_ = nullptr; o.mask_ = 0; o.size_ = 0;
+        }
+        FlatTable& operator=(FlatTable o) noexcept {
+            std::swap(ctrl_, o.ctrl_); std::swap(slots_, o.slots_);
+            std::swap(mask_, o.mask_); std::swap(size_, o.size_);
+            std::swap(keyof_, o.keyof_); std::swap(hash_, o.hash_); std::swap(eq_, o.eq_);
+            return *this;
+        }
+        ~FlatTable() { release(); }
+
+        DAXE_NODISCARD size_t size() const noexcept { return size_; }
+        DAXE_NODISCARD bool empty() const noexcept { return size_ == 0; }
+        // clear() keeps the slot array, so refilling to the same size never rehashes
+        void clear() noexcept {
+            if (!slots_) return;
+            for (size_t i = 0; i <= mask_; ++i) if (ctrl_[i]) slots_[i].~Entry();
+            std::memset(ctrl_, 0, ctrlbytes(mask_ + 1));
+            size_ = 0;
+        }
+
+        // reserve(n) - room for n entries without rehashing
+        void reserve(size_t n) {
+            size_t cap = 16;
+            while (cap * 3 < n * 4) cap *= 2;
+            if (cap > capacity()) rehash(cap);
+        }
+
+        // find(key) -> entry or nullptr; only the non-const overload hands out
+        // a mutable entry, and its key must still not be changed
+        template <typename K>
+        DAXE_NODISCARD const Entry* find(const K& key) const {
+            const size_t j = slotof(key);
+            return j != NOSLOT ? slots_ + j : nullptr;
+        }
+        template <typename K>
+        DAXE_NODISCARD Entry* find(const K& key) {
+            const size_t j = slotof(key);
+            return j != NOSLOT ? slots_ + j : nullptr;
+        }
+
+        // findorinsert(key, make) -> {entry, inserted}; make() builds the entry only on a miss
+        template <typename K, typename Make>
+        std::pair<Entry*, bool> findorinsert(const K& key, Make&& make) {
+            if ((size_ + 1) * 4 > capacity() * 3) grow();
+            const size_t h = hash_(key);
+            const u8 fp = fingerprint(h);
+            for (size_t i = h & mask_;; i = (i + CTRLGROUP) & mask_) {
+                const u32 empty = matchctrl(ctrl_ + i, 0);
+                u32 hit = matchctrl(ctrl_ + i, fp) & ((empty & (0 - empty)) - 1);
+                for (; hit; hit &= hit - 1) {
+                    const size_t j = (i + static_cast<size_t>(trailingzeros(hit))) & mask_;
+                    if (eq_(keyof_(slots_[j]), key)) return {slots_ + j, false};
+                }
+                if (empty) {
+                    const size_t j = (i + static_cast<size_t>(trailingzeros(empty))) & mask_;
+                    ::new (static_cast<void*>(slots_ + j)) Entry(make());
+                    setctrl(j, fp);
+                    ++size_;
+                    return {slots_ + j, true};
+                }
+            }
+        }
+
+        std::pair<Entry*, bool> insert(const Entry& e) { return findorinsert(keyof_(e), [&]() -> const Entry& { return e; }); }
+        std::pair<Entry*, bool> insert(Entry&& e) { return findorinsert(keyof_(e), [&]() -> Entry&& { return std::move(e); }); }
+
+        // erase(key) -> true if it was present
+        template <typename K>
+        bool erase(const K& key) {
+            size_t i = slotof(key);
+            if (i == NOSLOT) return false;
+            slots_[i].~Entry();
+            setctrl(i, 0);
+            --size_;
+            // Pull later members of the probe run back into the hole
+            for (size_t j = (i + 1) & mask_; ctrl_[j]; j = (j + 1) & mask_) {
+                const size_t home = hash_(keyof_(slots_[j])) & mask_;
+                if (((j - home) & mask_) < ((j - i) & mask_)) continue;  // home lies in (i, j]
+                ::new (static_cast<void*>(slots_ + i)) Entry(std::move(slots_[j]));
+                slots_[j].~Entry();
+                setctrl(i, ctrl_[j]);
+                setctrl(j, 0);
+                i = j;
+            }
+            return true;
+        }
+
+        // Iteration in slot order (unspecified but deterministic for a given insert sequence)
+        template <typename E>
+        class Iter {
+            const u8* ctrl_; E* slot_; E* end_;
+            void skip() noexcept { while (slot_ != end_ && !*ctrl_) { ++ctrl_; ++slot_; } }
+        public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type = std::remove_const_t<E>;
+            using difference_type = i64;
+            using pointer = E*;
+            using reference = E&;
+            Iter(const u8* ctrl, E* slot, E* end) noexcept : ctrl_(ctrl), slot_(slot), end_(end) { skip(); }
+            DAXE_NODISCARD reference operator*() const noexcept { return *slot_; }
+            DAXE_NODISCARD pointer operator->() const noexcept { return slot_; }
+            Iter& operator++() noexcept { ++ctrl_; ++slot_; skip(); return *this; }
+            DAXE_NODISCARD bool operator==(const Iter& o) const noexcept { return slot_ == o.slot_; }
+            DAXE_NODISCARD bool operator!=(const Iter& o) const noexcept { return slot_ != o.slot_; }
+        };
+        using iterator = Iter<Entry>;
+        using const_iterator = Iter<const Entry>;
+
+        DAXE_NODISCARD iterator begin() noexcept { return iterator(ctrl_, slots_, slots_ + capacity()); }
+        DAXE_NODISCARD iterator end() noexcept { return iterator(ctrl_ + capacity(), slots_ + capacity(), slots_ + capacity()); }
+        DAXE_NODISCARD const_iterator begin() const noexcept { return const_iterator(ctrl_, slots_, slots_ + capacity()); }
+        DAXE_NODISCARD const_iterator end() const noexcept { return const_iterator(ctrl_ + capacity(), slots_ + capacity(), slots_ + capacity()); }
+    };
+}
+
+// ==========================================
+// HASHSET CLASS
+// ==========================================
+template <typename T = i64, typename Hasher = Hash>
+class HashSet {
+    detail::FlatTable<T, detail::SelfKey, Hasher> table_;
+public:
+    using value_type = T;
+    using iterator = typename detail::FlatTable<T, detail::SelfKey, Hasher>::const_iterator;
+
+    HashSet() = default;
+    HashSet(std::initializer_list<T> init) { table_.reserve(init.size()); for (const auto& x : init) table_.insert(x); }
+    template <typename It>
+    HashSet(It first, It last) { for (; first != last; ++first) table_.insert(*first); }
+
+    template <typename U> bool add(U&& x) { return table_.insert(T(std::forward<U>(x))).second; }
+    DAXE_NODISCARD bool has(const T& x) const { return table_.find(x) != nullptr; }
+    bool remove(const T& x) { return table_.erase(x); }
+
+    DAXE_NODISCARD size_t size() const noexcept { return table_.size(); }
+    DAXE_NODISCARD bool empty() const noexcept { return table_.empty(); }
+    void clear() noexcept { table_.clear(); }
+    void reserve(size_t n) { table_.reserve(n); }
+
+    DAXE_NODISCARD iterator begin() const noexcept { return table_.begin(); }
+    DAXE_NODISCARD iterator end() const noexcept { return table_.end(); }
+    DAXE_NODISCARD std::vector<T> tovector() const { return std::vector<T>(begin(), end()); }
+};
+
+template <typename T> HashSet(std::initializer_list<T>) -> HashSet<T>;
+
+// ==========================================
+// HASHDICT CLASS
+// ==========================================
+// Drop-in for Dict where order does not matter. Iteration yields
+// std::pair<K, V>& in slot order; do not modify the key through it.
+template <typename K = str, typename V = i64, typename Hasher = Hash>
+class HashDict {
+    using Entry = std::pair<K, V>;
+    using Table = detail::FlatTable<Entry, detail::FirstKey, Hasher>;
+    Table table_;
+
+public:
+    using key_type = K;
+    using mapped_type = V;
+    using value_type = Entry;
+    using iterator = typename Table::iterator;
+    using const_iterator = typename Table::const_iterator;
+
+    HashDict() = default;
+    HashDict(std::initializer_list<Entry> init) { table_.reserve(init.size()); for (const auto& e : init) table_.insert(e); }
+    template <typename It>
+    HashDict(It first, It last) { for (; first != last; ++first) table_.insert(Entry(*first)); }
+
+    V& operator[](const K& key) { return table_.findorinsert(key, [&] { return Entry(key, V{}); }).first->second; }
+    V& operator[](K&& key) { return table_.findorinsert(key, [&] { return Entry(std::move(key), V{}); }).first->second; }
+
+    DAXE_NODISCARD bool has(const K& key) const { return table_.find(key) != nullptr; }
+    DAXE_NODISCARD bool contains(const K& key) const { return has(key); }
+    DAXE_NODISCARD size_t count(const K& key) const { return has(key) ? 1 : 0; }
+    DAXE_NODISCARD Option<V> getat(const K& key) const { const Entry* e = table_.find(key); return e ? Some(e->second) : None; }
+    DAXE_NODISCARD V getor(const K& key, const V& def) const { const Entry* e = table_.find(key); return e ? e->second : def; }
+    DAXE_NODISCARD V get(const K& key, const V& def) const { return getor(key, def); }
+    DAXE_NODISCARD V& at(const K& key) {
+        Entry* e = table_.find(key);
+        if (!e) DAXE_UNLIKELY panic("HashDict::at: key not found");
+        return e->second;
+    }
+    DAXE_NODISCARD const V& at(const K& key) const {
+        const Entry* e = table_.find(key);
+        if (!e) DAXE_UNLIKELY panic("HashDict::at: key not found");
+        return e->second;
+    }
+
+    template <typename VV> void set(const K& key, VV&& value) { (*this)[key] = std::forward<VV>(value); }
+    V& setdefault(const K& key, const V& def) { return table_.findorinsert(key, [&] { return Entry(key, def); }).first->second; }
+
+    bool remove(const K& key) { return table_.erase(key); }
+    size_t erase(const K& key) { return table_.erase(key) ? 1 : 0; }
+    DAXE_NODISCARD Option<V> pop(const K& key) {
+        Entry* e = table_.find(key);
+        if (!e) DAXE_UNLIKELY return None;
+        V val = std::move(e->second);
+        table_.erase(key);
+        return Some(std::move(val));
+    }
+
+    DAXE_NODISCARD List<K> keys() const { List<K> r; r.reserve(size()); for (const auto& [k, v] : *this) r.push_back(k); return r; }
+    DAXE_NODISCARD List<V> values() const { List<V> r; r.reserve(size()); for (const auto& [k, v] : *this) r.push_back(v); return r; }
+    DAXE_NODISCARD List<Entry> items() const { List<Entry> r; r.reserve(size()); for (const auto& e : *this) r.push_back(e); return r; }
+    void update(const HashDict& other) { for (const auto& [k, v] : other) (*this)[k] = v; }
+    void merge(const HashDict& other) { update(other); }
+
+    DAXE_NODISCARD size_t size() const noexcept { return table_.size(); }
+    DAXE_NODISCARD bool empty() const noexcept { return table_.empty(); }
+    void clear() noexcept { table_.clear(); }
+    void reserve(size_t n) { table_.reserve(n); }
+
+    DAXE_NODISCARD iterator begin() noexcept { return table_.begin(); }
+    DAXE_NODISCARD iterator end() noexcept { return table_.end(); }
+    DAXE_NODISCARD const_iterator begin() const noexcept { return table_.begin(); }
+    DAXE_NODISCARD const_iterator end() const noexcept { return table_.end(); }
+};
+
+// ==========================================
+// DEDUPLICATION
+// ==========================================
+namespace detail {
+    // Small trivially copyable elements are stored in the table directly.
+    // Anything else is stored as its position in v, so large elements are
+    // never copied and keys are read back from v.
+    template <typename T>
+    struct IndexKey {
+        const T* data;
+        DAXE_NODISCARD const T& operator()(size_t i) const noexcept { return data[i]; }
+    };
+
+    template <typename T>
+    inline constexpr bool storesinline = std::is_trivially_copyable_v<T> && sizeof(T) <= 16;
+
+    // Calls f(i) for the first occurrence of every distinct v[i]; returns the distinct count
+    template <typename T, typename F>
+    inline size_t firstoccurrences(const std::vector<T>& v, F&& f) {
+        if constexpr (storesinline<T>) {
+            FlatTable<T, SelfKey, Hash> seen;
+            for (size_t i = 0; i < v.size(); ++i) if (seen.insert(v[i]).second) f(i);
+            return seen.size();
+        } else {
+            FlatTable<size_t, IndexKey<T>, Hash> seen(IndexKey<T>{v.data()});
+            for (size_t i = 0; i < v.size(); ++i) if (seen.findorinsert(v[i], [i] { return i; }).second) f(i);
+            return seen.size();
+        }
+    }
+}
+
+// dedupe(v) - distinct elements in first-occurrence order, O(n) expected
+template <typename T>
+DAXE_NODISCARD inline std::vector<T> dedupe(const std::vector<T>& v) {
+    std::vector<T> r;
+    detail::firstoccurrences(v, [&](size_t i) { r.push_back(v[i]); });
+    return r;
+}
+
+// distinctcount(v) - number of distinct elements, O(n) expected
+template <typename T>
+DAXE_NODISCARD inline i64 distinctcount(const std::vector<T>& v) {
+    return static_cast<i64>(detail::firstoccurrences(v, [](size_t) {}));
+}
+
+DAXE_NAMESPACE_END
+
+#endif // DAXE_HASHTABLE_H
@@ -0,0 +1,324 @@
+/*
+ * DAXE - STRING INTERNING
+ * D.A's Axe - Cut through C++ verbosity
+ *
+ * StringPool - copies each distinct string once into an arena and hands
+ * out a 32-bit Symbol; equal strings get equal symbols, so comparing and
+ * hashing keys is O(1) and never touches the characters.
+ * SymbolDict<V> / SymbolSet - Dict / Set keyed by Symbol. Symbols are
+ * dense (0, 1, 2, ... in first-intern order), so both are plain arrays
+ * indexed by id.
+ *
+ *   StringPool pool;
+ *   SymbolDict<i64> freq;
+ *   for (Symbol w : pool.tokens(text)) ++freq[w];
+ *
+ * Naming: Flat style (no snake_case)
+ */
+
+#ifndef DAXE_INTERN_H
+#define DAXE_INTERN_H
+
+#include "base.h"
+#include "safe.h"
+#include "math.h"
+#include "simd.h"
+#include "hashtable.h"
+#include "pythonic.h"
+#include <cstring>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+DAXE_NAMESPACE_BEGIN
+
+// ==========================================
+// SYMBOL
+// ==========================================
+struct Symbol {
+    u32 id = 0;
+
+    DAXE_NODISCARD friend constexpr bool operator==(Symbol a, Symbol b) noexcept { return a.id == b.id; }
+    DAXE_NODISCARD friend constexpr bool operator!=(Symbol a, Symbol b) noexcept { return a.id != b.id; }
+    // Orders by first intern, not alphabetically
+    DAXE_NODISCARD friend constexpr bool operator<(Symbol a, Symbol b) noexcept { return a.id < b.id; }
+};
+
+DAXE_NAMESPACE_END
+
+#ifndef DAXE_NO_NAMESPACE
+template <>
+struct std::hash<dax::Symbol> {
+    DAXE_NODISCARD size_t operator()(dax::Symbol s) const noexcept { return s.id; }
+};
+#else
+template <>
+struct std::hash<Symbol> {
+    DAXE_NODISCARD size_t operator()(Symbol s) const noexcept { return s.id; }
+};
+#endif
+
+DAXE_NAMESPACE_BEGIN
+
+// ==========================================
+// STRING POOL
+// ==========================================
+// Characters live in fixed 64 KB chunks (longer strings get their own), so
+// views handed out stay valid while the pool grows or is moved.
+class StringPool {
+    static constexpr size_t CHUNK = size_t{64} << 10;
+
+    std::vector<std::unique_ptr<char[]>> chunks_;
+    size_t left_ = 0;         // free bytes at the end of the current chunk
+    char* top_ = nullptr;
+    size_t bytes_ = 0;
+    std::vector<strview> views_;
+    detail::FlatTable<std::pair<strview, u32>, detail::FirstKey, Hash> index_;
+
+    strview store(strview s) {
+        if (s.empty()) return {};
+        if (s.size() > left_) {
+            if (s.size() > CHUNK / 4) {
+                // Keep the current chunk for the small strings that follow
+                chunks_.push_back(std::make_unique<char[]>(s.size()));
+                std::memcpy(chunks_.back().get(), s.data(), s.size());
+                bytes_ += s.size();
+                return {chunks_.back().get(), s.size()};
+            }
+            chunks_.push_back(std::make_unique<char[]>(CHUNK));
+            top_ = chunks_.back().get();
+            left_ = CHUNK;
+        }
+        std::memcpy(top_, s.data(), s.size());
+        const strview r(top_, s.size());
+        top_ += s.size();
+        left_ -= s.size();
+        bytes_ += s.size();
+        return r;
+    }
+
+public:
+    StringPool() = default;
+    StringPool(const StringPool&) = delete;
+    StringPool& operator=(const StringPool&) = delete;
+    StringPool(StringPool&&) noexcept = default;
+    StringPool& operator=(StringPool&&) noexcept = default;
+
+    // Room for n distinct strings without rehashing
+    void reserve(size_t n) {
+        views_.reserve(n);
+        index_.reserve(n);
+    }
+
+    // Symbol of s, interning it on first sight
+    Symbol intern(strview s) {
+        auto [e, inserted] = index_.findorinsert(s, [&] {
+            return std::pair<strview, u32>(store(s), static_cast<u32>(views_.size()));
+        });
+        if (inserted) {
+            if (views_.size() == std::numeric_limits<u32>::max()) DAXE_UNLIKELY panic("StringPool: more than 2^32 - 1 symbols");
+            views_.push_back(e->first);
+        }
+        return Symbol{e->second};
+    }
+
+    // Symbol of s if it was interned before; never inserts
+    DAXE_NODISCARD Option<Symbol> lookup(strview s) const {
+        if (const auto* e = index_.find(s)) return Some(Symbol{e->second});
+        return None;
+    }
+
+    DAXE_NODISCARD bool has(strview s) const { return index_.find(s) != nullptr; }
+
+    // Interns every whitespace-separated token of text, in order
+    DAXE_NODISCARD std::vector<Symbol> tokens(strview text) {
+        std::vector<Symbol> r;
+        size_t i = 0;
+        while (i < text.size()) {
+            while (i < text.size() && detail::spacebyte(text[i])) ++i;
+            const size_t start = i;
+            while (i < text.size() && !detail::spacebyte(text[i])) ++i;
+            if (i > start) r.push_back(intern(text.substr(start, i - start)));
+        }
+        return r;
+    }
+
+    DAXE_NODISCARD strview view(Symbol s) const {
+        if (s.id >= views_.size()) DAXE_UNLIKELY panic("StringPool: symbol from another pool");
+        return views_[s.id];
+    }
+    DAXE_NODISCARD strview operator[](Symbol s) const { return view(s); }
+    DAXE_NODISCARD str tostr(Symbol s) const { return str(view(s)); }
+
+    DAXE_NODISCARD i64 size() const noexcept { return static_cast<i64>(views_.size()); }
+    DAXE_NODISCARD bool empty() const noexcept { return views_.empty(); }
+    // Characters stored, each distinct string once
+    DAXE_NODISCARD i64 bytes() const noexcept { return static_cast<i64>(bytes_); }
+};
+
+// ==========================================
+// SYMBOL DICT / SET
+// ==========================================
+// Slot i belongs to Symbol{i}; storage grows to the largest id seen. Keys
+// come back in id order. For a few keys out of a huge pool, use a hash table.
+template <typename V = i64>
+class SymbolDict {
+    std::vector<V> values_;
+    std::vector<u8> present_;
+    i64 size_ = 0;
+
+    void grow(u32 id) {
+        if (id < present_.size()) return;
+        const size_t cap = std::max<size_t>(size_t{id} + 1, present_.size() * 2);
+        values_.resize(cap);
+        present_.resize(cap, 0);
+    }
+
+public:
+    SymbolDict() = default;
+    SymbolDict(std::initializer_list<std::pair<Symbol, V>> init) { for (const auto& [k, v] : init) set(k, v); }
+
+    DAXE_NODISCARD bool has(Symbol k) const noexcept { return k.id < present_.size() && present_[k.id]; }
+    DAXE_NODISCARD Option<V> getat(Symbol k) const noexcept { return has(k) ? Some(values_[k.id]) : None; }
+    DAXE_NODISCARD V getor(Symbol k, const V& def) const noexcept { return has(k) ? values_[k.id] : def; }
+    DAXE_NODISCARD V get(Symbol k, const V& def) const { return getor(k, def); }
+
+    // Value-initialized on first access, like Dict::operator[]
+    V& operator[](Symbol k) {
+        grow(k.id);
+        if (!present_[k.id]) { present_[k.id] = 1; values_[k.id] = V{}; ++size_; }
+        return values_[k.id];
+    }
+    template <typename VV> void set(Symbol k, VV&& value) { (*this)[k] = std::forward<VV>(value); }
+    V& setdefault(Symbol k, const V& def) {
+        if (has(k)) return values_[k.id];
+        return (*this)[k] = def;
+    }
+
+    bool remove(Symbol k) noexcept {
+        if (!has(k)) return false;
+        present_[k.id] = 0;
+        values_[k.id] = V{};
+        --size_;
+        return true;
+    }
+    DAXE_NODISCARD Option<V> pop(Symbol k) {
+        if (!has(k)) DAXE_UNLIKELY return None;
+        V val = std::move(values_[k.id]);
+        remove(k);
+        return Some(std::move(val));
+    }
+
+    DAXE_NODISCARD List<Symbol> keys() const {
+        List<Symbol> r;
+        r.reserve(static_cast<size_t>(size_));
+        for (size_t i = 0; i < present_.size(); ++i) if (present_[i]) r.push_back(Symbol{static_cast<u32>(i)});
+        return r;
+    }
+    DAXE_NODISCARD List<V> values() const {
+        List<V> r;
+        r.reserve(static_cast<size_t>(size_));
+        for (size_t i = 0; i < present_.size(); ++i) if (present_[i]) r.push_back(values_[i]);
+        return r;
+    }
+    DAXE_NODISCARD List<std::pair<Symbol, V>> items() const {
+        List<std::pair<Symbol, V>> r;
+        r.reserve(static_cast<size_t>(size_));
+        for (size_t i = 0; i < present_.size(); ++i) if (present_[i]) r.push_back({Symbol{static_cast<u32>(i)}, values_[i]});
+        return r;
+    }
+    void update(const SymbolDict& other) {
+        for (size_t i = 0; i < other.present_.size(); ++i) if (other.present_[i]) set(Symbol{static_cast<u32>(i)}, other.values_[i]);
+    }
+
+    DAXE_NODISCARD i64 size() const noexcept { return size_; }
+    DAXE_NODISCARD bool empty() const noexcept { return size_ == 0; }
+    void clear() noexcept {
+        std::fill(present_.begin(), present_.end(), u8{0});
+        std::fill(values_.begin(), values_.end(), V{});
+        size_ = 0;
+    }
+};
+
+// One bit per id
+class SymbolSet {
+    std::vector<u64> words_;
+    i64 size_ = 0;
+
+public:
+    SymbolSet() = default;
+    SymbolSet(std::initializer_list<Symbol> init) { for (Symbol s : init) add(s); }
+
+    bool add(Symbol s) {
+        const size_t w = s.id >> 6;
+        if (w >= words_.size()) words_.resize(std::max(w + 1, words_.size() * 2), 0);
+        const u64 m = u64{1} << (s.id & 63);
+        if (words_[w] & m) return false;
+        words_[w] |= m;
+        ++size_;
+        return true;
+    }
+    DAXE_NODISCARD bool has(Symbol s) const noexcept {
+        const size_t w = s.id >> 6;
+        return w < words_.size() && (words_[w] >> (s.id & 63) & 1);
+    }
+    bool remove(Symbol s) noexcept {
+        if (!has(s)) return false;
+        words_[s.id >> 6] &= ~(u64{1} << (s.id & 63));
+        --size_;
+        return true;
+    }
+
+    DAXE_NODISCARD SymbolSet unite(const SymbolSet& o) const {
+        SymbolSet r = words_.size() >= o.words_.size() ? *this : o;
+        const SymbolSet& shorter = words_.size() >= o.words_.size() ? o : *this;
+        for (size_t w = 0; w < shorter.words_.size(); ++w) r.words_[w] |= shorter.words_[w];
+        r.recount();
+        return r;
+    }
+    DAXE_NODISCARD SymbolSet intersect(const SymbolSet& o) const {
+        SymbolSet r;
+        r.words_.resize(std::min(words_.size(), o.words_.size()));
+        for (size_t w = 0; w < r.words_.size(); ++w) r.words_[w] = words_[w] & o.words_[w];
+        r.recount();
+        return r;
+    }
+    DAXE_NODISCARD SymbolSet difference(const SymbolSet& o) const {
+        SymbolSet r = *this;
+        for (size_t w = 0; w < std::min(words_.size(), o.words_.size()); ++w) r.words_[w] &= ~o.words_[w];
+        r.recount();
+        return r;
+    }
+    DAXE_NODISCARD bool issubset(const SymbolSet& o) const noexcept {
+        for (size_t w = 0; w < words_.size(); ++w) {
+            if (words_[w] & ~(w < o.words_.size() ? o.words_[w] : 0)) return false;
+        }
+        return true;
+    }
+
+    // Members in id order
+    DAXE_NODISCARD List<Symbol> tolist() const {
+        List<Symbol> r;
+        r.reserve(static_cast<size_t>(size_));
+        for (size_t w = 0; w < words_.size(); ++w)
+            for (u64 m = words_[w]; m; m &= m - 1) r.push_back(Symbol{static_cast<u32>(w * 64 + static_cast<size_t>(trailingzeros(m)))});
+        return r;
+    }
+
+    DAXE_NODISCARD i64 size() const noexcept { return size_; }
+    DAXE_NODISCARD bool empty() const noexcept { return size_ == 0; }
+    void clear() noexcept { std::fill(words_.begin(), words_.end(), u64{0}); size_ = 0; }
+
+private:
+    void recount() noexcept {
+        size_ = 0;
+        for (u64 w : words_) size_ += bitcount(w);
+    }
+};
+
+DAXE_NAMESPACE_END
+
+#endif // DAXE_INTERN_H
@@ -11,6 +11,7 @@
 
 #include "config.h"
 #include "base.h"
+#include "sort.h"
 #include <limits>
 #include <cstring>
 #include <algorithm>
@@ -96,11 +97,11 @@ DAXE_NAMESPACE_END
 // ==========================================
 // ALGORITHM MACROS - Clear names
 // ==========================================
-#define sortasc(x) std::sort((x).begin(), (x).end())
-#define sortdesc(x) std::sort((x).rbegin(), (x).rend())
+#define sortasc(x) dax::detail::sortcontainer(x)
+#define sortdesc(x) dax::detail::sortcontainerdesc(x)
 // 'flip' macro removed to avoid collision with std::vector<bool>::flip()
 #define reverseall(x) std::reverse((x).begin(), (x).end())
-#define uniquify(x) do { std::sort((x).begin(), (x).end()); (x).erase(std::unique((x).begin(), (x).end()), (x).end()); } while(0)
+#define uniquify(x) do { dax::detail::sortcontainer(x); (x).erase(std::unique((x).begin(), (x).end()), (x).end()); } while(0)
 #define lowerbound(c, x) std::lower_bound((c).begin(), (c).end(), x)
 #define upperbound(c, x) std::upper_bound((c).begin(), (c).end(), x)
 
@@ -0,0 +1,150 @@
+/*
+ * DAXE - MEMOIZATION
+ * D.A's Axe - Cut through C++ verbosity
+ *
+ * memoize<R(Args...)>(fn) - caches a recursive function of its arguments.
+ * fn receives the memo itself as its first parameter for the recursive calls.
+ *
+ *   auto paths = memoize<i64(i64, i64)>({n, m}, [&](auto& self, i64 i, i64 j) -> i64 {
+ *       if (i == 0 || j == 0) return 1;
+ *       return self(i - 1, j) + self(i, j - 1);
+ *   });
+ *
+ * With bounds every argument must lie in [0, bound) and states live in one
+ * dense array. Without bounds states go into a flat hash table; integer
+ * arguments that fit in 64 bits together are packed into a single key.
+ *
+ * Naming: Flat style (no snake_case)
+ */
+
+#ifndef DAXE_MEMO_H
+#define DAXE_MEMO_H
+
+#include "base.h"
+#include "safe.h"
+#include "hashtable.h"
+#include <algorithm>
+#include <array>
+#include <functional>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+DAXE_NAMESPACE_BEGIN
+
+namespace detail {
+    template <typename... Args>
+    inline constexpr bool packablestate = (std::is_integral_v<Args> && ...) && (sizeof(Args) + ... + 0) <= 8;
+
+    template <typename T>
+    DAXE_NODISCARD constexpr u64 packfield(u64 key, const T& x) noexcept {
+        constexpr size_t BITS = 8 * sizeof(T);
+        if constexpr (BITS == 64) return static_cast<u64>(x);
+        else return (key << BITS) | (static_cast<u64>(x) & ((u64{1} << BITS) - 1));
+    }
+
+    // Each argument keeps its own bit range, so distinct states never collide
+    template <typename... Args>
+    DAXE_NODISCARD constexpr u64 packstate(const Args&... args) noexcept {
+        u64 key = 0;
+        ((key = packfield(key, args)), ...);
+        return key;
+    }
+}
+
+// ==========================================
+// MEMO
+// ==========================================
+template <typename Sig, typename Fn>
+class Memo;
+
+template <typename R, typename... Args, typename Fn>
+class Memo<R(Args...), Fn> {
+    static constexpr size_t ARITY = sizeof...(Args);
+    static constexpr bool PACKED = detail::packablestate<std::decay_t<Args>...>;
+    static constexpr bool DENSEABLE = ARITY > 0 && (std::is_integral_v<std::decay_t<Args>> && ...);
+
+    using Key = std::conditional_t<PACKED, u64, std::tuple<std::decay_t<Args>...>>;
+
+    Fn fn_;
+    detail::FlatTable<std::pair<Key, R>, detail::FirstKey, Hash> table_;
+    std::array<i64, ARITY> bounds_{};
+    std::vector<R> values_;
+    std::vector<u8> known_;
+    bool dense_ = false;
+
+    DAXE_NODISCARD size_t denseindex(const Args&... args) const {
+        size_t idx = 0, d = 0;
+        bool inside = true;
+        ((inside = inside && static_cast<i64>(args) >= 0 && static_cast<i64>(args) < bounds_[d],
+          idx = idx * static_cast<size_t>(bounds_[d]) + static_cast<size_t>(static_cast<i64>(args)), ++d), ...);
+        if (!inside) DAXE_UNLIKELY panic("memoize: argument outside the declared bounds");
+        return idx;
+    }
+
+    DAXE_NODISCARD static Key makekey(const Args&... args) {
+        if constexpr (PACKED) return detail::packstate(args...);
+        else return Key(args...);
+    }
+
+public:
+    explicit Memo(Fn f) : fn_(std::move(f)) {}
+
+    // bounds[d] - exclusive upper bound of argument d; every state gets a slot up front
+    Memo(const std::array<i64, ARITY>& bounds, Fn f) : fn_(std::move(f)), bounds_(bounds), dense_(true) {
+        static_assert(DENSEABLE, "dense memo tables need integer arguments");
+        size_t cells = 1;
+        for (i64 b : bounds_) {
+            if (b < 0) panic("memoize: negative bound");
+            cells *= static_cast<size_t>(b);
+        }
+        values_.resize(cells);
+        known_.assign(cells, 0);
+    }
+
+    R operator()(Args... args) {
+        if constexpr (DENSEABLE) {
+            if (dense_) {
+                const size_t idx = denseindex(args...);
+                if (known_[idx]) return values_[idx];
+                R r = fn_(*this, args...);
+                values_[idx] = r;
+                known_[idx] = 1;
+                return r;
+            }
+        }
+        Key key = makekey(args...);
+        if (const auto* hit = table_.find(key)) return hit->second;
+        // fn may recurse and rehash the table, so the entry is placed afterwards
+        R r = fn_(*this, args...);
+        table_.insert(std::pair<Key, R>(std::move(key), r));
+        return r;
+    }
+
+    // Forget every cached state; storage is kept for the next test case
+    void clear() noexcept {
+        if (dense_) std::fill(known_.begin(), known_.end(), u8{0});
+        else table_.clear();
+    }
+
+    DAXE_NODISCARD size_t size() const noexcept {
+        return dense_ ? static_cast<size_t>(std::count(known_.begin(), known_.end(), u8{1})) : table_.size();
+    }
+};
+
+template <typename Sig, typename Fn>
+DAXE_NODISCARD inline Memo<Sig, std::decay_t<Fn>> memoize(Fn&& f) {
+    return Memo<Sig, std::decay_t<Fn>>(std::forward<Fn>(f));
+}
+
+template <typename Sig, size_t N, typename Fn>
+DAXE_NODISCARD inline Memo<Sig, std::decay_t<Fn>> memoize(const i64 (&bounds)[N], Fn&& f) {
+    std::array<i64, N> b{};
+    std::copy(bounds, bounds + N, b.begin());
+    return Memo<Sig, std::decay_t<Fn>>(b, std::forward<Fn>(f));
+}
+
+DAXE_NAMESPACE_END
+
+#endif // DAXE_MEMO_H
@@ -0,0 +1,440 @@
+/*
+ * DAXE - PARALLEL EXECUTION
+ * D.A's Axe - Cut through C++ verbosity
+ *
+ * Opt-in parallel overloads: pass `par` as the first argument.
+ *   sum(par, v), count(par, v, x), transform(par, v, f), filter(par, v, pred)
+ *   sorted(par, v), all/any/none(par, v, pred), reduce(par, v, f)
+ *
+ * Work is cut into fixed-size chunks (independent of thread count) and
+ * partial results are combined left to right, so output is deterministic.
+ */
+
+#ifndef DAXE_PARALLEL_H
+#define DAXE_PARALLEL_H
+
+#include "base.h"
+#include "functions.h"
+#include "range.h"
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <deque>
+#include <memory>
+#include <functional>
+#include <exception>
+
+DAXE_NAMESPACE_BEGIN
+
+// ==========================================
+// EXECUTION TAG
+// ==========================================
+struct Parallel {};
+inline constexpr Parallel par{};
+
+// ==========================================
+// THREAD POOL
+// ==========================================
+class ThreadPool {
+    std::vector<std::thread> workers_;
+    std::deque<std::function<void()>> tasks_;
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    bool stop_ = false;
+
+    // Shared between the caller and helpers of one run()
+    struct Job {
+        std::atomic<i64> next{0};
+        std::atomic<i64> done{0};
+        i64 chunks = 0;
+        std::function<void(i64)> body;
+        std::mutex mutex;
+        std::condition_variable cv;
+        std::exception_ptr error;
+
+        void work() {
+            for (i64 i; (i = next.fetch_add(1)) < chunks;) {
+                try { body(i); }
+                catch (...) { std::lock_guard<std::mutex> lock(mutex); if (!error) error = std::current_exception(); }
+                if (done.fetch_add(1) + 1 == chunks) { std::lock_guard<std::mutex> lock(mutex); cv.notify_all(); }
+            }
+        }
+    };
+
+public:
+    // The calling thread always takes part, so n threads means n - 1 workers
+    explicit ThreadPool(i64 threads = static_cast<i64>(std::thread::hardware_concurrency())) {
+        if (threads < 1) threads = 1;
+        workers_.reserve(static_cast<size_t>(threads - 1));
+        for (i64 i = 1; i < threads; ++i) {
+            workers_.emplace_back([this] {
+                for (;;) {
+                    std::function<void()> task;
+                    {
+                        std::unique_lock<std::mutex> lock(mutex_);
+                        cv_.wait(lock, [this] { return stop_ || !tasks_.empty(); });
+                        if (stop_ && tasks_.empty()) return;
+                        task = std::move(tasks_.front());
+                        tasks_.pop_front();
+                    }
+                    task();
+                }
+            });
+        }
+    }
+
+    ~ThreadPool() {
+        { std::lock_guard<std::mutex> lock(mutex_); stop_ = true; }
+        cv_.notify_all();
+        for (auto& w : workers_) w.join();
+    }
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    DAXE_NODISCARD i64 size() const noexcept { return static_cast<i64>(workers_.size()) + 1; }
+
+    // run(chunks, f) -> calls f(i) for every i in [0, chunks), blocks until all are done.
+    // Safe to nest: the caller keeps draining chunks itself instead of waiting idle.
+    template <typename F>
+    void run(i64 chunks, F&& f) {
+        if (chunks <= 0) return;
+        if (chunks == 1 || workers_.empty()) {
+            for (i64 i = 0; i < chunks; ++i) f(i);
+            return;
+        }
+        auto job = std::make_shared<Job>();
+        job->chunks = chunks;
+        job->body = [&f](i64 i) { f(i); };
+        const i64 helpers = std::min(chunks - 1, static_cast<i64>(workers_.size()));
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            for (i64 i = 0; i < helpers; ++i) tasks_.emplace_back([job] { job->work(); });
+        }
+        cv_.notify_all();
+        job->work();
+        std::unique_lock<std::mutex> lock(job->mutex);
+        job->cv.wait(lock, [&] { return job->done.load() == chunks; });
+        if (job->error) std::rethrow_exception(job->error);
+    }
+};
+
+// Shared pool using Meyers Singleton pattern (module-friendly, like rng())
+inline ThreadPool& threadpool() {
+    static ThreadPool instance{};
+    return instance;
+}
+
+// ==========================================
+// PARALLEL FOR
+// ==========================================
+namespace detail {
+    // Chunk size is fixed so partial results never depend on the machine
+    inline constexpr i64 PARALLEL_GRAIN = 1 << 16;
+
+    DAXE_NODISCARD constexpr i64 chunkcount(i64 n, i64 grain = PARALLEL_GRAIN) noexcept {
+        return n <= 0 ? 0 : (n + grain - 1) / grain;
+    }
+}
+
+// parallelfor(n, f) -> calls f(lo, hi) over consecutive blocks covering [0, n)
+template <typename Func>
+inline void parallelfor(i64 n, Func&& f, i64 grain = detail::PARALLEL_GRAIN) {
+    if (grain < 1) grain = 1;
+    const i64 chunks = detail::chunkcount(n, grain);
+    threadpool().run(chunks, [&](i64 c) { f(c * grain, std::min(n, (c + 1) * grain)); });
+}
+
+namespace detail {
+    // Per-chunk results, folded left to right in chunk order
+    template <typename R, typename Map, typename Combine>
+    DAXE_NODISCARD inline R chunkreduce(i64 n, R init, Map&& map, Combine&& combine) {
+        const i64 chunks = chunkcount(n);
+        std::vector<R> partial(static_cast<size_t>(chunks), init);
+        parallelfor(n, [&](i64 lo, i64 hi) { partial[static_cast<size_t>(lo / PARALLEL_GRAIN)] = map(lo, hi); });
+        for (auto& p : partial) init = combine(std::move(init), std::move(p));
+        return init;
+    }
+}
+
+// ==========================================
+// PARALLEL GETTERS & PREDICATES
+// ==========================================
+
+// sum(par, v) - chunked sum, fixed association order
+template <typename T>
+DAXE_NODISCARD inline T sum(Parallel, const std::vector<T>& v) {
+    return detail::chunkreduce(static_cast<i64>(v.size()), T{},
+        [&](i64 lo, i64 hi) {
+            if constexpr (detail::issimdtype<T>) return detail::simdsum(v.data() + lo, static_cast<size_t>(hi - lo));
+            else return std::accumulate(v.begin() + lo, v.begin() + hi, T{});
+        },
+        [](T a, T b) { return a + b; });
+}
+
+// count(par, v, value) -> occurrences
+template <typename T, typename U>
+DAXE_NODISCARD inline i64 count(Parallel, const std::vector<T>& v, const U& value) {
+    return detail::chunkreduce(static_cast<i64>(v.size()), i64{0},
+        [&](i64 lo, i64 hi) { return static_cast<i64>(std::count(v.begin() + lo, v.begin() + hi, value)); },
+        [](i64 a, i64 b) { return a + b; });
+}
+
+// any(par, v, pred) - stops scanning new chunks once a match is found
+template <typename T, typename Pred>
+DAXE_NODISCARD inline bool any(Parallel, const std::vector<T>& v, Pred&& pred) {
+    std::atomic<bool> found{false};
+    parallelfor(static_cast<i64>(v.size()), [&](i64 lo, i64 hi) {
+        if (found.load(std::memory_order_relaxed)) return;
+        if (std::any_of(v.begin() + lo, v.begin() + hi, pred)) found.store(true, std::memory_order_relaxed);
+    });
+    return found.load();
+}
+
+template <typename T, typename Pred>
+DAXE_NODISCARD inline bool all(Parallel, const std::vector<T>& v, Pred&& pred) {
+    return !any(par, v, [&](const T& x) { return !pred(x); });
+}
+
+template <typename T, typename Pred>
+DAXE_NODISCARD inline bool none(Parallel, const std::vector<T>& v, Pred&& pred) {
+    return !any(par, v, std::forward<Pred>(pred));
+}
+
+// ==========================================
+// PARALLEL COPIES
+// ==========================================
+
+// transform(par, v, f) - output slots are written in place, order preserved
+template <typename T, typename Func>
+DAXE_NODISCARD inline auto transform(Parallel, const std::vector<T>& v, Func&& f) -> std::vector<decltype(f(std::declval<T>()))> {
+    using U = decltype(f(std::declval<T>()));
+    std::vector<U> r(v.size());
+    parallelfor(static_cast<i64>(v.size()), [&](i64 lo, i64 hi) {
+        for (i64 i = lo; i < hi; ++i) r[static_cast<size_t>(i)] = f(v[static_cast<size_t>(i)]);
+    });
+    return r;
+}
+
+// filter(par, v, pred) - chunks filter locally, then concatenate in order
+template <typename T, typename Pred>
+DAXE_NODISCARD inline std::vector<T> filter(Parallel, const std::vector<T>& v, Pred&& pred) {
+    const i64 n = static_cast<i64>(v.size());
+    std::vector<std::vector<T>> parts(static_cast<size_t>(detail::chunkcount(n)));
+    parallelfor(n, [&](i64 lo, i64 hi) {
+        auto& part = parts[static_cast<size_t>(lo / detail::PARALLEL_GRAIN)];
+        for (i64 i = lo; i < hi; ++i) if (pred(v[static_cast<size_t>(i)])) part.push_back(v[static_cast<size_t>(i)]);
+    });
+    std::vector<size_t> offset(parts.size() + 1, 0);
+    for (size_t i = 0; i < parts.size(); ++i) offset[i + 1] = offset[i] + parts[i].size();
+    std::vector<T> r(offset.back());
+    threadpool().run(static_cast<i64>(parts.size()), [&](i64 c) {
+        std::move(parts[static_cast<size_t>(c)].begin(), parts[static_cast<size_t>(c)].end(), r.begin() + static_cast<std::ptrdiff_t>(offset[static_cast<size_t>(c)]));
+    });
+    return r;
+}
+
+template <typename T, typename Pred>
+DAXE_NODISCARD inline std::vector<T> filtered(Parallel, const std::vector<T>& v, Pred&& pred) {
+    return filter(par, v, std::forward<Pred>(pred));
+}
+
+// ==========================================
+// PARALLEL REDUCTIONS
+// ==========================================
+
+// reduce(par, v, f) - f must be associative; T{} for empty input
+template <typename T, typename Func>
+DAXE_NODISCARD inline T reduce(Parallel, const std::vector<T>& v, Func&& f) {
+    if (v.empty()) DAXE_UNLIKELY return T{};
+    const i64 n = static_cast<i64>(v.size());
+    std::vector<T> partial(static_cast<size_t>(detail::chunkcount(n)));
+    parallelfor(n, [&](i64 lo, i64 hi) {
+        T r = v[static_cast<size_t>(lo)];
+        for (i64 i = lo + 1; i < hi; ++i) r = f(r, v[static_cast<size_t>(i)]);
+        partial[static_cast<size_t>(lo / detail::PARALLEL_GRAIN)] = std::move(r);
+    });
+    T r = std::move(partial[0]);
+    for (size_t i = 1; i < partial.size(); ++i) r = f(std::move(r), std::move(partial[i]));
+    return r;
+}
+
+// fold(par, v, init, f, combine) - every chunk folds from init, so init must be
+// an identity for combine (0 for +, 1 for *, "" for concatenation)
+template <typename T, typename U, typename Func, typename Combine>
+DAXE_NODISCARD inline U fold(Parallel, const std::vector<T>& v, U init, Func&& f, Combine&& combine) {
+    const i64 n = static_cast<i64>(v.size());
+    if (n == 0) DAXE_UNLIKELY return init;
+    std::vector<U> partial(static_cast<size_t>(detail::chunkcount(n)), init);
+    parallelfor(n, [&](i64 lo, i64 hi) {
+        U acc = init;
+        for (i64 i = lo; i < hi; ++i) acc = f(std::move(acc), v[static_cast<size_t>(i)]);
+        partial[static_cast<size_t>(lo / detail::PARALLEL_GRAIN)] = std::move(acc);
+    });
+    U r = std::move(partial[0]);
+    for (size_t i = 1; i < partial.size(); ++i) r = combine(std::move(r), std::move(partial[i]));
+    return r;
+}
+
+// ==========================================
+// PARALLEL SCANS
+// ==========================================
+namespace detail {
+    // Two-pass scan: every chunk computes its total, the totals are scanned
+    // serially, then every chunk rescans itself starting from its carry-in.
+    // Reads src[i] before writing dst[i], so dst may alias src.
+    template <typename T, typename Op>
+    inline void parallelscan(const T* src, T* dst, i64 n, Op& op) {
+        constexpr bool PLUS = issimdscantype<T> && (std::is_same_v<Op, std::plus<T>> || std::is_same_v<Op, std::plus<>>);
+        const i64 chunks = chunkcount(n);
+        std::vector<T> total(static_cast<size_t>(chunks));
+        parallelfor(n, [&](i64 lo, i64 hi) {
+            T& out = total[static_cast<size_t>(lo / PARALLEL_GRAIN)];
+            if constexpr (PLUS) {
+                out = simdsum(src + lo, static_cast<size_t>(hi - lo));
+            } else {
+                T acc = src[lo];
+                for (i64 i = lo + 1; i < hi; ++i) acc = op(acc, src[i]);
+                out = std::move(acc);
+            }
+        });
+        for (size_t c = 1; c < total.size(); ++c) total[c] = op(total[c - 1], total[c]);
+        parallelfor(n, [&](i64 lo, i64 hi) {
+            const size_t c = static_cast<size_t>(lo / PARALLEL_GRAIN);
+            if constexpr (PLUS) {
+                simdprefixsum(src + lo, dst + lo, static_cast<size_t>(hi - lo), c ? total[c - 1] : T{});
+            } else {
+                T acc = c ? op(total[c - 1], src[lo]) : src[lo];
+                dst[lo] = acc;
+                for (i64 i = lo + 1; i < hi; ++i) dst[i] = acc = op(acc, src[i]);
+            }
+        });
+    }
+}
+
+// inclusivescan(par, v, op) - op must be associative
+template <typename T, typename Op = std::plus<T>>
+DAXE_NODISCARD inline std::vector<T> inclusivescan(Parallel, const std::vector<T>& v, Op op = Op{}) {
+    std::vector<T> result(v.size());
+    detail::parallelscan(v.data(), result.data(), static_cast<i64>(v.size()), op);
+    return result;
+}
+
+template <typename T, typename Op = std::plus<T>>
+inline void inclusivescaninplace(Parallel, std::vector<T>& v, Op op = Op{}) {
+    detail::parallelscan(v.data(), v.data(), static_cast<i64>(v.size()), op);
+}
+
+// prefixsum(par, v) - two-pass parallel prefix sum
+template <typename T>
+DAXE_NODISCARD inline std::vector<T> prefixsum(Parallel, const std::vector<T>& v) {
+    return inclusivescan(par, v, std::plus<T>{});
+}
+
+template <typename T>
+inline void prefixsuminplace(Parallel, std::vector<T>& v) {
+    inclusivescaninplace(par, v, std::plus<T>{});
+}
+
+// ==========================================
+// PARALLEL SORT
+// ==========================================
+
+namespace detail {
+    template <typename T, typename Compare>
+    inline constexpr bool isplainless = std::is_same_v<Compare, std::less<>> || std::is_same_v<Compare, std::less<T>>;
+
+    // One bucket, or a small input: radix for integer keys under operator<, else std::sort
+    template <typename T, typename Compare>
+    inline void sortbucket(T* data, size_t n, Compare& comp) {
+        if constexpr (isplainless<T, Compare>) sortrange(data, n);
+        else std::sort(data, data + n, comp);
+    }
+
+    inline constexpr i64 SAMPLESORT_MAX_SPLITTERS = 1024;
+    inline constexpr i64 SAMPLESORT_OVERSAMPLE = 16;
+
+    // Sample sort. Splitters come from an evenly spaced oversample. Every distinct
+    // splitter s gets two buckets: (previous, s) and [s, s]. Equal-key buckets
+    // need no sorting, which keeps heavy duplicates cheap. Elements are
+    // classified and scattered stably in parallel, then buckets sort concurrently.
+    template <typename T, typename Compare>
+    inline void samplesort(std::vector<T>& v, Compare& comp) {
+        const i64 n = static_cast<i64>(v.size());
+        const i64 want = std::min(SAMPLESORT_MAX_SPLITTERS, chunkcount(n) - 1);
+        std::vector<T> splitters;
+        splitters.reserve(static_cast<size_t>(want * SAMPLESORT_OVERSAMPLE));
+        for (i64 i = 0; i < want * SAMPLESORT_OVERSAMPLE; ++i) {
+            splitters.push_back(v[static_cast<size_t>((2 * i + 1) * n / (2 * want * SAMPLESORT_OVERSAMPLE))]);
+        }
+        std::sort(splitters.begin(), splitters.end(), comp);
+        for (i64 i = 0; i < want; ++i) splitters[static_cast<size_t>(i)] = splitters[static_cast<size_t>((i + 1) * SAMPLESORT_OVERSAMPLE - 1)];
+        splitters.resize(static_cast<size_t>(want));
+        splitters.erase(std::unique(splitters.begin(), splitters.end(),
+            [&](const T& a, const T& b) { return !comp(a, b) && !comp(b, a); }), splitters.end());
+        const size_t buckets = 2 * splitters.size() + 1;
+
+        // Classify: bucket ids plus per-block histograms
+        const i64 blocks = std::min(chunkcount(n), threadpool().size() * 4);
+        const i64 grain = (n + blocks - 1) / blocks;
+        std::vector<u16> id(v.size());
+        std::vector<size_t> count(static_cast<size_t>(blocks) * buckets, 0);
+        parallelfor(n, [&](i64 lo, i64 hi) {
+            size_t* c = count.data() + static_cast<size_t>(lo / grain) * buckets;
+            for (i64 i = lo; i < hi; ++i) {
+                const T& x = v[static_cast<size_t>(i)];
+                const size_t j = static_cast<size_t>(std::lower_bound(splitters.begin(), splitters.end(), x, comp) - splitters.begin());
+                const size_t b = 2 * j + (j < splitters.size() && !comp(x, splitters[j]) ? 1 : 0);
+                id[static_cast<size_t>(i)] = static_cast<u16>(b);
+                ++c[b];
+            }
+        }, grain);
+
+        // Offsets: bucket-major, blocks in order, so the scatter is stable
+        std::vector<size_t> start(buckets + 1, 0);
+        size_t offset = 0;
+        for (size_t b = 0; b < buckets; ++b) {
+            start[b] = offset;
+            for (i64 k = 0; k < blocks; ++k) {
+                size_t& c = count[static_cast<size_t>(k) * buckets + b];
+                const size_t x = c; c = offset; offset += x;
+            }
+        }
+        start[buckets] = offset;
+
+        std::vector<T> out(v.size());
+        parallelfor(n, [&](i64 lo, i64 hi) {
+            size_t* c = count.data() + static_cast<size_t>(lo / grain) * buckets;
+            for (i64 i = lo; i < hi; ++i) out[c[id[static_cast<size_t>(i)]]++] = std::move(v[static_cast<size_t>(i)]);
+        }, grain);
+
+        // Odd buckets hold one key each and are already in order
+        threadpool().run(static_cast<i64>(splitters.size() + 1), [&](i64 k) {
+            const size_t b = 2 * static_cast<size_t>(k);
+            sortbucket(out.data() + start[b], start[b + 1] - start[b], comp);
+        });
+        v.swap(out);
+    }
+}
+
+// parallelsort(v, comp) - in-place multi-threaded sort (not stable)
+template <typename T, typename Compare = std::less<>>
+inline void parallelsort(std::vector<T>& v, Compare comp = {}) {
+    if (static_cast<i64>(v.size()) < 2 * detail::PARALLEL_GRAIN || threadpool().size() == 1) {
+        detail::sortbucket(v.data(), v.size(), comp);
+        return;
+    }
+    detail::samplesort(v, comp);
+}
+
+// sorted(par, v) - parallelsort on a copy
+template <typename T, typename Compare = std::less<>>
+DAXE_NODISCARD inline std::vector<T> sorted(Parallel, std::vector<T> v, Compare comp = {}) {
+    parallelsort(v, comp);
+    return v;
+}
+
+DAXE_NAMESPACE_END
+
+#endif // DAXE_PARALLEL_H
@@ -12,11 +12,18 @@
 #include "containers.h"
 #include "safe.h"
 #include "english.h"
+#include "sort.h"
+#include "simd.h"
 #include <stack>
 #include <queue>
 #include <algorithm>
+#include <iterator>
 #include <numeric>
 
+#if DAXE_HAS_SPAN
+#include <span>
+#endif
+
 DAXE_NAMESPACE_BEGIN
 
 // ==========================================
@@ -44,6 +51,7 @@ public:
     using std::vector<T>::at;
     using std::vector<T>::front;
     using std::vector<T>::back;
+    using std::vector<T>::data;
     using std::vector<T>::clear;
     using std::vector<T>::insert;
     using std::vector<T>::erase;
@@ -106,29 +114,32 @@ public:
     }
     
     DAXE_NODISCARD i64 indexof(const T& x) const noexcept {
-        auto it = std::find(this->begin(), this->end(), x);
-        return it != this->end() ? it - this->begin() : -1;
+        const size_t i = detail::findin(vec(), x);
+        return i != this->size() ? static_cast<i64>(i) : -1;
     }
     
-    DAXE_NODISCARD i64 count(const T& x) const noexcept { return std::count(this->begin(), this->end(), x); }
-    DAXE_NODISCARD bool has(const T& x) const noexcept { return std::find(this->begin(), this->end(), x) != this->end(); }
+    DAXE_NODISCARD i64 count(const T& x) const noexcept { return static_cast<i64>(detail::countin(vec(), x)); }
+    DAXE_NODISCARD bool has(const T& x) const noexcept { return detail::findin(vec(), x) != this->size(); }
     
-    void sort() noexcept { std::sort(this->begin(), this->end()); }
-    void rsort() noexcept { std::sort(this->rbegin(), this->rend()); }
+    void sort() { detail::sortcontainer(vec()); }
+    void rsort() { detail::sortcontainerdesc(vec()); }
     void reverse() noexcept { std::reverse(this->begin(), this->end()); }
     
     DAXE_NODISCARD List<T> sorted() const { List<T> copy = *this; copy.sort(); return copy; }
     DAXE_NODISCARD List<T> reversed() const { List<T> copy = *this; copy.reverse(); return copy; }
     
     DAXE_NODISCARD List<T> slice(i64 start, i64 end) const {
-        const i64 n = static_cast<i64>(this->size());
-        if (start < 0) start += n; 
-        if (end < 0) end += n;
-        start = std::max(0LL, std::min(start, n));
-        end = std::max(0LL, std::min(end, n));
-        if (start >= end) DAXE_UNLIKELY return {};
+        if (!detail::normalizeslice(start, end, static_cast<i64>(this->size()))) DAXE_UNLIKELY return {};
         return List<T>(this->begin() + start, this->begin() + end);
     }
+
+#if DAXE_HAS_SPAN
+    // sliceview - slice() without the copy; valid until the list is resized
+    DAXE_NODISCARD std::span<const T> sliceview(i64 start, i64 end) const noexcept {
+        if (!detail::normalizeslice(start, end, static_cast<i64>(this->size()))) DAXE_UNLIKELY return {};
+        return std::span<const T>(this->data() + start, static_cast<size_t>(end - start));
+    }
+#endif
     
     DAXE_NODISCARD Option<T> getat(i64 idx) const noexcept {
         if (idx < 0) idx += static_cast<i64>(this->size());
@@ -142,11 +153,11 @@ public:
         return (*this)[static_cast<size_t>(idx)];
     }
     
-    DAXE_NODISCARD T sum() const noexcept { return std::accumulate(this->begin(), this->end(), T{}); }
-    DAXE_NODISCARD Option<T> max() const { if (this->empty()) return None; return Some(*std::max_element(this->begin(), this->end())); }
-    DAXE_NODISCARD Option<T> min() const { if (this->empty()) return None; return Some(*std::min_element(this->begin(), this->end())); }
-    DAXE_NODISCARD T max(const T& fallback) const { if (this->empty()) return fallback; return *std::max_element(this->begin(), this->end()); }
-    DAXE_NODISCARD T min(const T& fallback) const { if (this->empty()) return fallback; return *std::min_element(this->begin(), this->end()); }
+    DAXE_NODISCARD T sum() const noexcept { return detail::sumof(vec()); }
+    DAXE_NODISCARD Option<T> max() const { if (this->empty()) return None; return Some(detail::maxof(vec())); }
+    DAXE_NODISCARD Option<T> min() const { if (this->empty()) return None; return Some(detail::minof(vec())); }
+    DAXE_NODISCARD T max(const T& fallback) const { if (this->empty()) return fallback; return detail::maxof(vec()); }
+    DAXE_NODISCARD T min(const T& fallback) const { if (this->empty()) return fallback; return detail::minof(vec()); }
     
     template <typename Func>
     DAXE_NODISCARD List<T> filter(Func&& f) const {
@@ -225,16 +236,53 @@ public:
     DAXE_NODISCARD bool has(const T& x) const noexcept { return this->count(x) > 0; }
     bool remove(const T& x) noexcept { return this->erase(x) > 0; }
     DAXE_NODISCARD Option<T> pop() noexcept { if (this->empty()) DAXE_UNLIKELY return None; T val = std::move(*this->begin()); this->erase(this->begin()); return Some(std::move(val)); }
-    DAXE_NODISCARD Set<T> unite(const Set<T>& other) const { Set<T> r = *this; for (const auto& x : other) r.insert(x); return r; }
-    DAXE_NODISCARD Set<T> intersect(const Set<T>& other) const { Set<T> r; for (const auto& x : *this) if (other.has(x)) r.insert(x); return r; }
-    DAXE_NODISCARD Set<T> difference(const Set<T>& other) const { Set<T> r; for (const auto& x : *this) if (!other.has(x)) r.insert(x); return r; }
-    DAXE_NODISCARD bool issubset(const Set<T>& other) const noexcept { for (const auto& x : *this) if (!other.has(x)) DAXE_UNLIKELY return false; return true; }
+
+    // Set algebra merges the two sorted sequences and appends to the result
+    // with an end hint, O(n + m). When one side is GALLOPRATIO times
+    // smaller, its elements are looked up instead, O(small * log(large)).
+    DAXE_NODISCARD Set<T> unite(const Set<T>& other) const {
+        Set<T> r;
+        std::set_union(this->begin(), this->end(), other.begin(), other.end(), std::inserter(r, r.end()));
+        return r;
+    }
+    DAXE_NODISCARD Set<T> intersect(const Set<T>& other) const {
+        const Set<T>& shorter = this->size() <= other.size() ? *this : other;
+        const Set<T>& longer = this->size() <= other.size() ? other : *this;
+        Set<T> r;
+        if (shorter.size() * detail::GALLOPRATIO < longer.size()) {
+            for (const auto& x : shorter) if (longer.has(x)) r.insert(r.end(), x);
+        } else {
+            std::set_intersection(this->begin(), this->end(), other.begin(), other.end(), std::inserter(r, r.end()));
+        }
+        return r;
+    }
+    DAXE_NODISCARD Set<T> difference(const Set<T>& other) const {
+        if (other.size() * detail::GALLOPRATIO < this->size()) {
+            Set<T> r = *this;
+            for (const auto& x : other) r.erase(x);
+            return r;
+        }
+        Set<T> r;
+        if (this->size() * detail::GALLOPRATIO < other.size()) {
+            for (const auto& x : *this) if (!other.has(x)) r.insert(r.end(), x);
+        } else {
+            std::set_difference(this->begin(), this->end(), other.begin(), other.end(), std::inserter(r, r.end()));
+        }
+        return r;
+    }
+    DAXE_NODISCARD bool issubset(const Set<T>& other) const noexcept {
+        if (this->size() > other.size()) return false;
+        if (this->size() * detail::GALLOPRATIO < other.size()) {
+            for (const auto& x : *this) if (!other.has(x)) DAXE_UNLIKELY return false;
+            return true;
+        }
+        return std::includes(other.begin(), other.end(), this->begin(), this->end());
+    }
     DAXE_NODISCARD bool issuperset(const Set<T>& other) const noexcept { return other.issubset(*this); }
     DAXE_NODISCARD List<T> tolist() const { return List<T>(this->begin(), this->end()); }
     DAXE_NODISCARD Set<T> symmetricdiff(const Set<T>& other) const {
         Set<T> r;
-        for (const auto& x : *this) if (!other.has(x)) r.insert(x);
-        for (const auto& x : other) if (!this->has(x)) r.insert(x);
+        std::set_symmetric_difference(this->begin(), this->end(), other.begin(), other.end(), std::inserter(r, r.end()));
         return r;
     }
 };
@@ -3,6 +3,10 @@
  * D.A's Axe - Cut through C++ verbosity
  * 
  * Naming: Flat style (no snake_case)
+ *
+ * Views (takeview, dropview, sliceview, chainview, flattenview, rotatedview)
+ * borrow from their source instead of copying: the source must outlive the
+ * view and must not be resized while the view is in use.
  */
 
 #ifndef DAXE_RANGE_H
@@ -10,6 +14,13 @@
 
 #include "base.h"
 #include "safe.h"
+#include <algorithm>
+#include <iterator>
+#include <vector>
+
+#if DAXE_HAS_SPAN
+#include <span>
+#endif
 
 DAXE_NAMESPACE_BEGIN
 
@@ -160,6 +171,164 @@ DAXE_NODISCARD inline std::vector<T> drop(const std::vector<T>& v, i64 n) {
     return std::vector<T>(v.begin() + n, v.end()); 
 }
 
+// ==========================================
+// VIEWS (zero-copy, read-only)
+// ==========================================
+namespace detail {
+    // Forward iterator over any view that has operator[] and size()
+    template <typename View>
+    class ViewIterator {
+        const View* view_;
+        size_t i_;
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = typename View::value_type;
+        using difference_type = i64;
+        using pointer = const value_type*;
+        using reference = const value_type&;
+        constexpr ViewIterator() noexcept : view_(nullptr), i_(0) {}
+        constexpr ViewIterator(const View* view, size_t i) noexcept : view_(view), i_(i) {}
+        DAXE_NODISCARD constexpr reference operator*() const noexcept { return (*view_)[i_]; }
+        constexpr ViewIterator& operator++() noexcept { ++i_; return *this; }
+        constexpr ViewIterator operator++(int) noexcept { ViewIterator t = *this; ++i_; return t; }
+        DAXE_NODISCARD constexpr bool operator==(const ViewIterator& o) const noexcept { return i_ == o.i_; }
+        DAXE_NODISCARD constexpr bool operator!=(const ViewIterator& o) const noexcept { return i_ != o.i_; }
+    };
+}
+
+// ChainView - a followed by b
+template <typename T>
+class ChainView {
+    const T* a_; size_t na_;
+    const T* b_; size_t nb_;
+public:
+    using value_type = T;
+    using iterator = detail::ViewIterator<ChainView>;
+    constexpr ChainView(const T* a, size_t na, const T* b, size_t nb) noexcept : a_(a), na_(na), b_(b), nb_(nb) {}
+
+    DAXE_NODISCARD constexpr const T& operator[](size_t i) const noexcept { return i < na_ ? a_[i] : b_[i - na_]; }
+    DAXE_NODISCARD constexpr size_t size() const noexcept { return na_ + nb_; }
+    DAXE_NODISCARD constexpr bool empty() const noexcept { return size() == 0; }
+    DAXE_NODISCARD constexpr iterator begin() const noexcept { return iterator(this, 0); }
+    DAXE_NODISCARD constexpr iterator end() const noexcept { return iterator(this, size()); }
+    DAXE_NODISCARD std::vector<T> tovector() const {
+        std::vector<T> r; r.reserve(size());
+        r.insert(r.end(), a_, a_ + na_);
+        r.insert(r.end(), b_, b_ + nb_);
+        return r;
+    }
+};
+
+// RotatedView - v rotated left by an offset, like rotated()
+template <typename T>
+class RotatedView {
+    const T* data_; size_t n_, offset_;
+public:
+    using value_type = T;
+    using iterator = detail::ViewIterator<RotatedView>;
+    constexpr RotatedView(const T* data, size_t n, size_t offset) noexcept : data_(data), n_(n), offset_(offset) {}
+
+    DAXE_NODISCARD constexpr const T& operator[](size_t i) const noexcept {
+        const size_t j = i + offset_;
+        return data_[j >= n_ ? j - n_ : j];
+    }
+    DAXE_NODISCARD constexpr size_t size() const noexcept { return n_; }
+    DAXE_NODISCARD constexpr bool empty() const noexcept { return n_ == 0; }
+    DAXE_NODISCARD constexpr iterator begin() const noexcept { return iterator(this, 0); }
+    DAXE_NODISCARD constexpr iterator end() const noexcept { return iterator(this, n_); }
+    DAXE_NODISCARD std::vector<T> tovector() const {
+        std::vector<T> r; r.reserve(n_);
+        r.insert(r.end(), data_ + offset_, data_ + n_);
+        r.insert(r.end(), data_, data_ + offset_);
+        return r;
+    }
+};
+
+// FlattenView - the inner vectors back to back. size() walks the outer vector.
+template <typename T>
+class FlattenView {
+    const std::vector<std::vector<T>>* nested_;
+public:
+    using value_type = T;
+
+    class Iterator {
+        const std::vector<std::vector<T>>* nested_;
+        size_t outer_, inner_;
+        void skipempty() noexcept {
+            while (outer_ < nested_->size() && inner_ >= (*nested_)[outer_].size()) { ++outer_; inner_ = 0; }
+        }
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = T;
+        using difference_type = i64;
+        using pointer = const T*;
+        using reference = const T&;
+        Iterator() noexcept : nested_(nullptr), outer_(0), inner_(0) {}
+        Iterator(const std::vector<std::vector<T>>* nested, size_t outer) noexcept : nested_(nested), outer_(outer), inner_(0) { skipempty(); }
+        DAXE_NODISCARD reference operator*() const noexcept { return (*nested_)[outer_][inner_]; }
+        Iterator& operator++() noexcept { ++inner_; skipempty(); return *this; }
+        Iterator operator++(int) noexcept { Iterator t = *this; ++*this; return t; }
+        DAXE_NODISCARD bool operator==(const Iterator& o) const noexcept { return outer_ == o.outer_ && inner_ == o.inner_; }
+        DAXE_NODISCARD bool operator!=(const Iterator& o) const noexcept { return !(*this == o); }
+    };
+    using iterator = Iterator;
+
+    explicit FlattenView(const std::vector<std::vector<T>>& nested) noexcept : nested_(&nested) {}
+
+    DAXE_NODISCARD size_t size() const noexcept { size_t n = 0; for (const auto& v : *nested_) n += v.size(); return n; }
+    DAXE_NODISCARD bool empty() const noexcept { return begin() == end(); }
+    DAXE_NODISCARD iterator begin() const noexcept { return Iterator(nested_, 0); }
+    DAXE_NODISCARD iterator end() const noexcept { return Iterator(nested_, nested_->size()); }
+    DAXE_NODISCARD std::vector<T> tovector() const {
+        std::vector<T> r; r.reserve(size());
+        for (const auto& v : *nested_) r.insert(r.end(), v.begin(), v.end());
+        return r;
+    }
+};
+
+#if DAXE_HAS_SPAN
+// takeview(v, n) - first n elements (clamped)
+template <typename T>
+DAXE_NODISCARD inline std::span<const T> takeview(const std::vector<T>& v, i64 n) noexcept {
+    n = std::max<i64>(0, std::min(n, static_cast<i64>(v.size())));
+    return std::span<const T>(v.data(), static_cast<size_t>(n));
+}
+
+// dropview(v, n) - all but the first n elements (clamped)
+template <typename T>
+DAXE_NODISCARD inline std::span<const T> dropview(const std::vector<T>& v, i64 n) noexcept {
+    n = std::max<i64>(0, std::min(n, static_cast<i64>(v.size())));
+    return std::span<const T>(v.data() + n, v.size() - static_cast<size_t>(n));
+}
+
+// sliceview(v, start, end) - sliced() without the copy, same index rules
+template <typename T>
+DAXE_NODISCARD inline std::span<const T> sliceview(const std::vector<T>& v, i64 start, i64 end) noexcept {
+    if (!detail::normalizeslice(start, end, static_cast<i64>(v.size()))) DAXE_UNLIKELY return {};
+    return std::span<const T>(v.data() + start, static_cast<size_t>(end - start));
+}
+#endif
+
+// chainview(a, b) - chain() without the copy
+template <typename T>
+DAXE_NODISCARD inline ChainView<T> chainview(const std::vector<T>& a, const std::vector<T>& b) noexcept {
+    return ChainView<T>(a.data(), a.size(), b.data(), b.size());
+}
+
+// flattenview(nested) - flatten() without the copy
+template <typename T>
+DAXE_NODISCARD inline FlattenView<T> flattenview(const std::vector<std::vector<T>>& nested) noexcept {
+    return FlattenView<T>(nested);
+}
+
+// rotatedview(v, n) - rotated() without the copy (left by n, negative = right)
+template <typename T>
+DAXE_NODISCARD inline RotatedView<T> rotatedview(const std::vector<T>& v, i64 n) noexcept {
+    const i64 size = static_cast<i64>(v.size());
+    const i64 offset = size == 0 ? 0 : ((n % size) + size) % size;
+    return RotatedView<T>(v.data(), v.size(), static_cast<size_t>(offset));
+}
+
 template <typename T, typename Pred>
 DAXE_NODISCARD inline Option<T> findif(const std::vector<T>& v, Pred&& pred) noexcept {
     for (const auto& x : v) if (pred(x)) DAXE_LIKELY return Some(x);
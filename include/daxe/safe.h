@@ -56,6 +56,21 @@ namespace detail {
 #define DAXE_DEFER_3(x)    DAXE_DEFER_2(x, __COUNTER__)
 #define defer              auto DAXE_DEFER_3(_defer_) = dax::detail::DeferHelper{} + [&]()
 
+// ==========================================
+// SLICE BOUNDS
+// ==========================================
+namespace detail {
+    // Python-style [start, end) over length n: negative indices count from
+    // the back, then both ends are clamped to [0, n]. False if the slice is empty.
+    DAXE_NODISCARD constexpr bool normalizeslice(i64& start, i64& end, i64 n) noexcept {
+        if (start < 0) start += n;
+        if (end < 0) end += n;
+        start = start < 0 ? 0 : (start > n ? n : start);
+        end = end < 0 ? 0 : (end > n ? n : end);
+        return start < end;
+    }
+}
+
 // ==========================================
 // FORWARD DECLARATIONS
 // ==========================================
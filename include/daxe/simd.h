@@ -0,0 +1,910 @@
+/*
+ * DAXE - SIMD KERNELS
+ * D.A's Axe - Cut through C++ verbosity
+ *
+ * Vector kernels behind max, min, minmax, argmax, argmin and sum for
+ * i32 / u32 / i64 / u64 / f32 / f64 element types, and behind has, count
+ * and indexof for those plus 1-byte integers. i32 / i64 prefix sums use
+ * in-register scans. ASCII case mapping, character-class checks and
+ * whitespace scans for the string functions work 32 / 16 bytes at a time.
+ * - x86-64: AVX2, chosen at runtime (older CPUs take the scalar path)
+ * - AArch64: NEON
+ * - elsewhere, or with DAXE_NO_SIMD: the std:: algorithms
+ *
+ * Results are identical to the std:: algorithms, including which index
+ * wins a tie. Floating-point sums stay sequential, since reordering the
+ * additions would change the rounding.
+ */
+
+#ifndef DAXE_SIMD_H
+#define DAXE_SIMD_H
+
+#include "base.h"
+#include "math.h"
+#include "sort.h"
+#include <algorithm>
+#include <cctype>
+#include <numeric>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <cstddef>
+
+#if DAXE_SIMD_AVX2
+    #include <immintrin.h>
+#elif DAXE_SIMD_NEON
+    #include <arm_neon.h>
+#endif
+
+DAXE_NAMESPACE_BEGIN
+
+namespace detail {
+    // Element types with vector reductions
+    template <typename T>
+    inline constexpr bool issimdtype = std::is_same_v<T, i32> || std::is_same_v<T, u32> || std::is_same_v<T, i64> ||
+                                       std::is_same_v<T, u64> || std::is_same_v<T, f32> || std::is_same_v<T, f64>;
+
+    // Element types with vector search (equality only)
+    template <typename T>
+    inline constexpr bool issimdsearchtype = issimdtype<T> || std::is_same_v<T, i8> || std::is_same_v<T, u8> ||
+                                             std::is_same_v<T, char>;
+
+    // Element types with vector prefix sums (integer adds are exact in any order)
+    template <typename T>
+    inline constexpr bool issimdscantype = std::is_same_v<T, i32> || std::is_same_v<T, i64>;
+
+    // Is the vector path usable on this CPU? (checked once)
+#if DAXE_SIMD_AVX2
+    inline bool simdavailable() noexcept {
+        static const bool ok = [] {
+            __builtin_cpu_init();
+            return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("bmi") && __builtin_cpu_supports("popcnt");
+        }();
+        return ok;
+    }
+#else
+    constexpr bool simdavailable() noexcept { return DAXE_HAS_SIMD; }
+#endif
+
+    // ==========================================
+    // PER-TYPE VECTOR OPERATIONS
+    // ==========================================
+    // SimdOps<T>: V (register type), W (lanes), load, store, set, add, min,
+    // max, eq (lane bitmask). Float types add unord(acc, x) and any(acc)
+    // to track NaNs, which the kernels hand back to the std:: path.
+    // 1-byte types only provide load / set / eq, for search. i32 / i64 add
+    // scan(x) (in-register inclusive prefix sum) and last(x) (broadcast of
+    // the top lane).
+    template <typename T> struct SimdOps;
+
+#if DAXE_SIMD_AVX2
+    template <> struct SimdOps<i32> {
+        using V = __m256i;
+        static constexpr size_t W = 8;
+        static constexpr bool FLOAT = false;
+        DAXE_SIMD_TARGET static V load(const i32* p) noexcept { return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p)); }
+        DAXE_SIMD_TARGET static void store(i32* p, V a) noexcept { _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), a); }
+        DAXE_SIMD_TARGET static V set(i32 x) noexcept { return _mm256_set1_epi32(x); }
+        DAXE_SIMD_TARGET static V add(V a, V b) noexcept { return _mm256_add_epi32(a, b); }
+        DAXE_SIMD_TARGET static V min(V a, V b) noexcept { return _mm256_min_epi32(a, b); }
+        DAXE_SIMD_TARGET static V max(V a, V b) noexcept { return _mm256_max_epi32(a, b); }
+        DAXE_SIMD_TARGET static V scan(V x) noexcept {
+            x = _mm256_add_epi32(x, _mm256_slli_si256(x, 4));
+            x = _mm256_add_epi32(x, _mm256_slli_si256(x, 8));
+            const V low = _mm256_shuffle_epi32(x, 0xFF);  // top of each 128-bit half
+            return _mm256_add_epi32(x, _mm256_permute2x128_si256(low, low, 0x08));
+        }
+        DAXE_SIMD_TARGET static V last(V x) noexcept { return _mm256_permutevar8x32_epi32(x, _mm256_set1_epi32(7)); }
+        DAXE_SIMD_TARGET static u32 eq(V a, V b) noexcept {
+            return static_cast<u32>(_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(a, b))));
+        }
+    };
+
+    template <> struct SimdOps<u32> {
+        using V = __m256i;
+        static constexpr size_t W = 8;
+        static constexpr bool FLOAT = false;
+        DAXE_SIMD_TARGET static V load(const u32* p) noexcept { return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p)); }
+        DAXE_SIMD_TARGET static void store(u32* p, V a) noexcept { _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), a); }
+        DAXE_SIMD_TARGET static V set(u32 x) noexcept { return _mm256_set1_epi32(static_cast<int>(x)); }
+        DAXE_SIMD_TARGET static V add(V a, V b) noexcept { return _mm256_add_epi32(a, b); }
+        DAXE_SIMD_TARGET static V min(V a, V b) noexcept { return _mm256_min_epu32(a, b); }
+        DAXE_SIMD_TARGET static V max(V a, V b) noexcept { return _mm256_max_epu32(a, b); }
+        DAXE_SIMD_TARGET static u32 eq(V a, V b) noexcept {
+            return static_cast<u32>(_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(a, b))));
+        }
+    };
+
+    template <typename T> struct SimdBytes {
+        using V = __m256i;
+        static constexpr size_t W = 32;
+        static constexpr bool FLOAT = false;
+        DAXE_SIMD_TARGET static V load(const T* p) noexcept { return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p)); }
+        DAXE_SIMD_TARGET static V set(T x) noexcept { return _mm256_set1_epi8(static_cast<char>(x)); }
+        DAXE_SIMD_TARGET static u32 eq(V a, V b) noexcept { return static_cast<u32>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(a, b))); }
+    };
+    template <> struct SimdOps<i8> : SimdBytes<i8> {};
+    template <> struct SimdOps<u8> : SimdBytes<u8> {};
+    template <> struct SimdOps<char> : SimdBytes<char> {};
+
+    template <> struct SimdOps<i64> {
+        using V = __m256i;
+        static constexpr size_t W = 4;
+        static constexpr bool FLOAT = false;
+        DAXE_SIMD_TARGET static V load(const i64* p) noexcept { return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p)); }
+        DAXE_SIMD_TARGET static void store(i64* p, V a) noexcept { _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), a); }
+        DAXE_SIMD_TARGET static V set(i64 x) noexcept { return _mm256_set1_epi64x(x); }
+        DAXE_SIMD_TARGET static V add(V a, V b) noexcept { return _mm256_add_epi64(a, b); }
+        // No 64-bit min/max before AVX-512: compare, then blend
+        DAXE_SIMD_TARGET static V min(V a, V b) noexcept { return _mm256_blendv_epi8(a, b, _mm256_cmpgt_epi64(a, b)); }
+        DAXE_SIMD_TARGET static V max(V a, V b) noexcept { return _mm256_blendv_epi8(b, a, _mm256_cmpgt_epi64(a, b)); }
+        DAXE_SIMD_TARGET static u32 eq(V a, V b) noexcept {
+            return static_cast<u32>(_mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpeq_epi64(a, b))));
+        }
+        DAXE_SIMD_TARGET static V scan(V x) noexcept {
+            x = _mm256_add_epi64(x, _mm256_slli_si256(x, 8));
+            const V low = _mm256_permute4x64_epi64(x, 0x55);  // lane 1 everywhere
+            return _mm256_add_epi64(x, _mm256_blend_epi32(_mm256_setzero_si256(), low, 0xF0));
+        }
+        DAXE_SIMD_TARGET static V last(V x) noexcept { return _mm256_permute4x64_epi64(x, 0xFF); }
+    };
+
+    template <> struct SimdOps<u64> {
+        using V = __m256i;
+        static constexpr size_t W = 4;
+        static constexpr bool FLOAT = false;
+        DAXE_SIMD_TARGET static V load(const u64* p) noexcept { return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p)); }
+        DAXE_SIMD_TARGET static void store(u64* p, V a) noexcept { _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), a); }
+        DAXE_SIMD_TARGET static V set(u64 x) noexcept { return _mm256_set1_epi64x(static_cast<long long>(x)); }
+        DAXE_SIMD_TARGET static V add(V a, V b) noexcept { return _mm256_add_epi64(a, b); }
+        // Unsigned compare = signed compare with the sign bits flipped
+        DAXE_SIMD_TARGET static V gt(V a, V b) noexcept {
+            const V sign = _mm256_set1_epi64x(static_cast<long long>(1ULL << 63));
+            return _mm256_cmpgt_epi64(_mm256_xor_si256(a, sign), _mm256_xor_si256(b, sign));
+        }
+        DAXE_SIMD_TARGET static V min(V a, V b) noexcept { return _mm256_blendv_epi8(a, b, gt(a, b)); }
+        DAXE_SIMD_TARGET static V max(V a, V b) noexcept { return _mm256_blendv_epi8(b, a, gt(a, b)); }
+        DAXE_SIMD_TARGET static u32 eq(V a, V b) noexcept {
+            return static_cast<u32>(_mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpeq_epi64(a, b))));
+        }
+    };
+
+    template <> struct SimdOps<f32> {
+        using V = __m256;
+        static constexpr size_t W = 8;
+        static constexpr bool FLOAT = true;
+        DAXE_SIMD_TARGET static V load(const f32* p) noexcept { return _mm256_loadu_ps(p); }
+        DAXE_SIMD_TARGET static void store(f32* p, V a) noexcept { _mm256_storeu_ps(p, a); }
+        DAXE_SIMD_TARGET static V set(f32 x) noexcept { return _mm256_set1_ps(x); }
+        DAXE_SIMD_TARGET static V add(V a, V b) noexcept { return _mm256_add_ps(a, b); }
+        DAXE_SIMD_TARGET static V min(V a, V b) noexcept { return _mm256_min_ps(a, b); }
+        DAXE_SIMD_TARGET static V max(V a, V b) noexcept { return _mm256_max_ps(a, b); }
+        DAXE_SIMD_TARGET static u32 eq(V a, V b) noexcept { return static_cast<u32>(_mm256_movemask_ps(_mm256_cmp_ps(a, b, _CMP_EQ_OQ))); }
+        DAXE_SIMD_TARGET static V unord(V acc, V x) noexcept { return _mm256_or_ps(acc, _mm256_cmp_ps(x, x, _CMP_UNORD_Q)); }
+        DAXE_SIMD_TARGET static bool any(V acc) noexcept { return _mm256_movemask_ps(acc) != 0; }
+    };
+
+    template <> struct SimdOps<f64> {
+        using V = __m256d;
+        static constexpr size_t W = 4;
+        static constexpr bool FLOAT = true;
+        DAXE_SIMD_TARGET static V load(const f64* p) noexcept { return _mm256_loadu_pd(p); }
+        DAXE_SIMD_TARGET static void store(f64* p, V a) noexcept { _mm256_storeu_pd(p, a); }
+        DAXE_SIMD_TARGET static V set(f64 x) noexcept { return _mm256_set1_pd(x); }
+        DAXE_SIMD_TARGET static V add(V a, V b) noexcept { return _mm256_add_pd(a, b); }
+        DAXE_SIMD_TARGET static V min(V a, V b) noexcept { return _mm256_min_pd(a, b); }
+        DAXE_SIMD_TARGET static V max(V a, V b) noexcept { return _mm256_max_pd(a, b); }
+        DAXE_SIMD_TARGET static u32 eq(V a, V b) noexcept { return static_cast<u32>(_mm256_movemask_pd(_mm256_cmp_pd(a, b, _CMP_EQ_OQ))); }
+        DAXE_SIMD_TARGET static V unord(V acc, V x) noexcept { return _mm256_or_pd(acc, _mm256_cmp_pd(x, x, _CMP_UNORD_Q)); }
+        DAXE_SIMD_TARGET static bool any(V acc) noexcept { return _mm256_movemask_pd(acc) != 0; }
+    };
+#elif DAXE_SIMD_NEON
+    // NEON has no movemask: AND the compare result with lane bits, then add across
+    template <> struct SimdOps<i32> {
+        using V = int32x4_t;
+        static constexpr size_t W = 4;
+        static constexpr bool FLOAT = false;
+        static V load(const i32* p) noexcept { return vld1q_s32(p); }
+        static void store(i32* p, V a) noexcept { vst1q_s32(p, a); }
+        static V set(i32 x) noexcept { return vdupq_n_s32(x); }
+        static V add(V a, V b) noexcept { return vaddq_s32(a, b); }
+        static V min(V a, V b) noexcept { return vminq_s32(a, b); }
+        static V max(V a, V b) noexcept { return vmaxq_s32(a, b); }
+        static V scan(V x) noexcept {
+            x = vaddq_s32(x, vextq_s32(vdupq_n_s32(0), x, 3));
+            return vaddq_s32(x, vextq_s32(vdupq_n_s32(0), x, 2));
+        }
+        static V last(V x) noexcept { return vdupq_laneq_s32(x, 3); }
+        static u32 eq(V a, V b) noexcept {
+            const u32 bits[4] = {1, 2, 4, 8};
+            return vaddvq_u32(vandq_u32(vceqq_s32(a, b), vld1q_u32(bits)));
+        }
+    };
+
+    template <> struct SimdOps<u32> {
+        using V = uint32x4_t;
+        static constexpr size_t W = 4;
+        static constexpr bool FLOAT = false;
+        static V load(const u32* p) noexcept { return vld1q_u32(p); }
+        static void store(u32* p, V a) noexcept { vst1q_u32(p, a); }
+        static V set(u32 x) noexcept { return vdupq_n_u32(x); }
+        static V add(V a, V b) noexcept { return vaddq_u32(a, b); }
+        static V min(V a, V b) noexcept { return vminq_u32(a, b); }
+        static V max(V a, V b) noexcept { return vmaxq_u32(a, b); }
+        static u32 eq(V a, V b) noexcept {
+            const u32 bits[4] = {1, 2, 4, 8};
+            return vaddvq_u32(vandq_u32(vceqq_u32(a, b), vld1q_u32(bits)));
+        }
+    };
+
+    template <typename T> struct SimdBytes {
+        using V = uint8x16_t;
+        static constexpr size_t W = 16;
+        static constexpr bool FLOAT = false;
+        static V load(const T* p) noexcept { return vld1q_u8(reinterpret_cast<const u8*>(p)); }
+        static V set(T x) noexcept { return vdupq_n_u8(static_cast<u8>(x)); }
+        static u32 eq(V a, V b) noexcept {
+            const u8 bits[16] = {1, 2, 4, 8, 16, 32, 64, 128, 1, 2, 4, 8, 16, 32, 64, 128};
+            const uint8x16_t m = vandq_u8(vceqq_u8(a, b), vld1q_u8(bits));
+            return static_cast<u32>(vaddv_u8(vget_low_u8(m))) | static_cast<u32>(vaddv_u8(vget_high_u8(m))) << 8;
+        }
+    };
+    template <> struct SimdOps<i8> : SimdBytes<i8> {};
+    template <> struct SimdOps<u8> : SimdBytes<u8> {};
+    template <> struct SimdOps<char> : SimdBytes<char> {};
+
+    template <> struct SimdOps<i64> {
+        using V = int64x2_t;
+        static constexpr size_t W = 2;
+        static constexpr bool FLOAT = false;
+        static V load(const i64* p) noexcept { return vld1q_s64(p); }
+        static void store(i64* p, V a) noexcept { vst1q_s64(p, a); }
+        static V set(i64 x) noexcept { return vdupq_n_s64(x); }
+        static V add(V a, V b) noexcept { return vaddq_s64(a, b); }
+        static V min(V a, V b) noexcept { return vbslq_s64(vcgtq_s64(a, b), b, a); }
+        static V max(V a, V b) noexcept { return vbslq_s64(vcgtq_s64(a, b), a, b); }
+        static V scan(V x) noexcept { return vaddq_s64(x, vextq_s64(vdupq_n_s64(0), x, 1)); }
+        static V last(V x) noexcept { return vdupq_laneq_s64(x, 1); }
+        static u32 eq(V a, V b) noexcept {
+            const u64 bits[2] = {1, 2};
+            return static_cast<u32>(vaddvq_u64(vandq_u64(vceqq_s64(a, b), vld1q_u64(bits))));
+        }
+    };
+
+    template <> struct SimdOps<u64> {
+        using V = uint64x2_t;
+        static constexpr size_t W = 2;
+        static constexpr bool FLOAT = false;
+        static V load(const u64* p) noexcept { return vld1q_u64(p); }
+        static void store(u64* p, V a) noexcept { vst1q_u64(p, a); }
+        static V set(u64 x) noexcept { return vdupq_n_u64(x); }
+        static V add(V a, V b) noexcept { return vaddq_u64(a, b); }
+        static V min(V a, V b) noexcept { return vbslq_u64(vcgtq_u64(a, b), b, a); }
+        static V max(V a, V b) noexcept { return vbslq_u64(vcgtq_u64(a, b), a, b); }
+        static u32 eq(V a, V b) noexcept {
+            const u64 bits[2] = {1, 2};
+            return static_cast<u32>(vaddvq_u64(vandq_u64(vceqq_u64(a, b), vld1q_u64(bits))));
+        }
+    };
+
+    template <> struct SimdOps<f32> {
+        using V = float32x4_t;
+        static constexpr size_t W = 4;
+        static constexpr bool FLOAT = true;
+        static V load(const f32* p) noexcept { return vld1q_f32(p); }
+        static void store(f32* p, V a) noexcept { vst1q_f32(p, a); }
+        static V set(f32 x) noexcept { return vdupq_n_f32(x); }
+        static V add(V a, V b) noexcept { return vaddq_f32(a, b); }
+        static V min(V a, V b) noexcept { return vminq_f32(a, b); }
+        static V max(V a, V b) noexcept { return vmaxq_f32(a, b); }
+        static u32 eq(V a, V b) noexcept {
+            const u32 bits[4] = {1, 2, 4, 8};
+            return vaddvq_u32(vandq_u32(vceqq_f32(a, b), vld1q_u32(bits)));
+        }
+        static V unord(V acc, V x) noexcept {
+            return vreinterpretq_f32_u32(vorrq_u32(vreinterpretq_u32_f32(acc), vmvnq_u32(vceqq_f32(x, x))));
+        }
+        static bool any(V acc) noexcept { return vmaxvq_u32(vreinterpretq_u32_f32(acc)) != 0; }
+    };
+
+    template <> struct SimdOps<f64> {
+        using V = float64x2_t;
+        static constexpr size_t W = 2;
+        static constexpr bool FLOAT = true;
+        static V load(const f64* p) noexcept { return vld1q_f64(p); }
+        static void store(f64* p, V a) noexcept { vst1q_f64(p, a); }
+        static V set(f64 x) noexcept { return vdupq_n_f64(x); }
+        static V add(V a, V b) noexcept { return vaddq_f64(a, b); }
+        static V min(V a, V b) noexcept { return vminq_f64(a, b); }
+        static V max(V a, V b) noexcept { return vmaxq_f64(a, b); }
+        static u32 eq(V a, V b) noexcept {
+            const u64 bits[2] = {1, 2};
+            return static_cast<u32>(vaddvq_u64(vandq_u64(vceqq_f64(a, b), vld1q_u64(bits))));
+        }
+        static V unord(V acc, V x) noexcept {
+            const uint64x2_t nan = veorq_u64(vceqq_f64(x, x), vdupq_n_u64(~0ULL));
+            return vreinterpretq_f64_u64(vorrq_u64(vreinterpretq_u64_f64(acc), nan));
+        }
+        static bool any(V acc) noexcept {
+            const uint64x2_t m = vreinterpretq_u64_f64(acc);
+            return (vgetq_lane_u64(m, 0) | vgetq_lane_u64(m, 1)) != 0;
+        }
+    };
+#endif
+
+    // ==========================================
+    // KERNELS
+    // ==========================================
+    enum : int { SIMD_SUM, SIMD_MIN, SIMD_MAX };
+
+    template <int OP, typename T>
+    DAXE_NODISCARD constexpr T scalarapply(T a, T b) noexcept {
+        if constexpr (OP == SIMD_SUM) return static_cast<T>(a + b);
+        else if constexpr (OP == SIMD_MIN) return b < a ? b : a;
+        else return a < b ? b : a;
+    }
+
+#if DAXE_HAS_SIMD
+    template <int OP, typename O, typename V>
+    DAXE_SIMD_TARGET inline V simdapply(V a, V b) noexcept {
+        if constexpr (OP == SIMD_SUM) return O::add(a, b);
+        else if constexpr (OP == SIMD_MIN) return O::min(a, b);
+        else return O::max(a, b);
+    }
+
+    // Reduce p[0, n) with four independent accumulators. Sets nan if any
+    // element is NaN (the result is then meaningless).
+    template <int OP, typename T>
+    DAXE_SIMD_TARGET inline T simdreducekernel(const T* p, size_t n, bool& nan) noexcept {
+        using O = SimdOps<T>;
+        using V = typename O::V;
+        constexpr size_t W = O::W;
+        nan = false;
+        size_t i = 0;
+        T r = OP == SIMD_SUM ? T{} : p[0];
+        if (n >= 4 * W) {
+            V a0 = O::load(p), a1 = O::load(p + W), a2 = O::load(p + 2 * W), a3 = O::load(p + 3 * W);
+            [[maybe_unused]] V bad = O::set(T{});
+            if constexpr (O::FLOAT) bad = O::unord(O::unord(O::unord(O::unord(bad, a0), a1), a2), a3);
+            for (i = 4 * W; i + 4 * W <= n; i += 4 * W) {
+                const V x0 = O::load(p + i), x1 = O::load(p + i + W), x2 = O::load(p + i + 2 * W), x3 = O::load(p + i + 3 * W);
+                a0 = simdapply<OP, O>(a0, x0);
+                a1 = simdapply<OP, O>(a1, x1);
+                a2 = simdapply<OP, O>(a2, x2);
+                a3 = simdapply<OP, O>(a3, x3);
+                if constexpr (O::FLOAT) bad = O::unord(O::unord(O::unord(O::unord(bad, x0), x1), x2), x3);
+            }
+            if constexpr (O::FLOAT) nan = O::any(bad);
+            T lanes[W];
+            O::store(lanes, simdapply<OP, O>(simdapply<OP, O>(a0, a1), simdapply<OP, O>(a2, a3)));
+            r = lanes[0];
+            for (size_t k = 1; k < W; ++k) r = scalarapply<OP>(r, lanes[k]);
+        }
+        for (; i < n; ++i) {
+            if constexpr (O::FLOAT) nan = nan || p[i] != p[i];
+            r = scalarapply<OP>(r, p[i]);
+        }
+        return r;
+    }
+
+    // Min and max in one pass, two accumulators each
+    template <typename T>
+    DAXE_SIMD_TARGET inline std::pair<T, T> simdminmaxkernel(const T* p, size_t n, bool& nan) noexcept {
+        using O = SimdOps<T>;
+        using V = typename O::V;
+        constexpr size_t W = O::W;
+        nan = false;
+        size_t i = 0;
+        T lo = p[0], hi = p[0];
+        if (n >= 2 * W) {
+            V mn0 = O::load(p), mn1 = O::load(p + W), mx0 = mn0, mx1 = mn1;
+            [[maybe_unused]] V bad = O::set(T{});
+            if constexpr (O::FLOAT) bad = O::unord(O::unord(bad, mn0), mn1);
+            for (i = 2 * W; i + 2 * W <= n; i += 2 * W) {
+                const V x0 = O::load(p + i), x1 = O::load(p + i + W);
+                mn0 = O::min(mn0, x0); mx0 = O::max(mx0, x0);
+                mn1 = O::min(mn1, x1); mx1 = O::max(mx1, x1);
+                if constexpr (O::FLOAT) bad = O::unord(O::unord(bad, x0), x1);
+            }
+            if constexpr (O::FLOAT) nan = O::any(bad);
+            T lanes[W];
+            O::store(lanes, O::min(mn0, mn1));
+            lo = lanes[0];
+            for (size_t k = 1; k < W; ++k) lo = scalarapply<SIMD_MIN>(lo, lanes[k]);
+            O::store(lanes, O::max(mx0, mx1));
+            hi = lanes[0];
+            for (size_t k = 1; k < W; ++k) hi = scalarapply<SIMD_MAX>(hi, lanes[k]);
+        }
+        for (; i < n; ++i) {
+            if constexpr (O::FLOAT) nan = nan || p[i] != p[i];
+            lo = scalarapply<SIMD_MIN>(lo, p[i]);
+            hi = scalarapply<SIMD_MAX>(hi, p[i]);
+        }
+        return {lo, hi};
+    }
+
+    // First index of x in p[0, n), or n. Four vectors per step, early exit.
+    template <typename T>
+    DAXE_SIMD_TARGET inline size_t simdfindkernel(const T* p, size_t n, T x) noexcept {
+        using O = SimdOps<T>;
+        using V = typename O::V;
+        constexpr size_t W = O::W;
+        const V key = O::set(x);
+        size_t i = 0;
+        for (; i + 4 * W <= n; i += 4 * W) {
+            const u32 m0 = O::eq(O::load(p + i), key), m1 = O::eq(O::load(p + i + W), key);
+            const u32 m2 = O::eq(O::load(p + i + 2 * W), key), m3 = O::eq(O::load(p + i + 3 * W), key);
+            if (m0 | m1 | m2 | m3) DAXE_UNLIKELY {
+                if (m0) return i + static_cast<size_t>(trailingzeros(m0));
+                if (m1) return i + W + static_cast<size_t>(trailingzeros(m1));
+                if (m2) return i + 2 * W + static_cast<size_t>(trailingzeros(m2));
+                return i + 3 * W + static_cast<size_t>(trailingzeros(m3));
+            }
+        }
+        for (; i + W <= n; i += W) {
+            const u32 m = O::eq(O::load(p + i), key);
+            if (m) return i + static_cast<size_t>(trailingzeros(m));
+        }
+        for (; i < n; ++i) if (p[i] == x) return i;
+        return n;
+    }
+
+    // Occurrences of x in p[0, n), one counter per unrolled vector
+    template <typename T>
+    DAXE_SIMD_TARGET inline size_t simdcountkernel(const T* p, size_t n, T x) noexcept {
+        using O = SimdOps<T>;
+        using V = typename O::V;
+        constexpr size_t W = O::W;
+        const V key = O::set(x);
+        size_t i = 0, c0 = 0, c1 = 0, c2 = 0, c3 = 0;
+        for (; i + 4 * W <= n; i += 4 * W) {
+            c0 += static_cast<size_t>(bitcount(O::eq(O::load(p + i), key)));
+            c1 += static_cast<size_t>(bitcount(O::eq(O::load(p + i + W), key)));
+            c2 += static_cast<size_t>(bitcount(O::eq(O::load(p + i + 2 * W), key)));
+            c3 += static_cast<size_t>(bitcount(O::eq(O::load(p + i + 3 * W), key)));
+        }
+        for (; i + W <= n; i += W) c0 += static_cast<size_t>(bitcount(O::eq(O::load(p + i), key)));
+        for (; i < n; ++i) c1 += p[i] == x;
+        return c0 + c1 + c2 + c3;
+    }
+
+    // dst[i] = carry + src[0] + ... + src[i]; dst may alias src
+    template <typename T>
+    DAXE_SIMD_TARGET inline void simdprefixkernel(const T* src, T* dst, size_t n, T carry) noexcept {
+        using O = SimdOps<T>;
+        using V = typename O::V;
+        constexpr size_t W = O::W;
+        V c = O::set(carry);
+        size_t i = 0;
+        // Two local scans per step; only the final add touches the carry chain
+        for (; i + 2 * W <= n; i += 2 * W) {
+            const V s0 = O::scan(O::load(src + i));
+            const V s1 = O::add(O::scan(O::load(src + i + W)), O::last(s0));
+            O::store(dst + i, O::add(s0, c));
+            O::store(dst + i + W, O::add(s1, c));
+            c = O::add(c, O::last(s1));
+        }
+        for (; i + W <= n; i += W) {
+            const V x = O::add(O::scan(O::load(src + i)), c);
+            O::store(dst + i, x);
+            c = O::last(x);
+        }
+        T acc = i ? dst[i - 1] : carry;
+        for (; i < n; ++i) dst[i] = acc = static_cast<T>(acc + src[i]);
+    }
+#endif
+
+    // ==========================================
+    // DISPATCH (pointer + length, T must be a simd type)
+    // ==========================================
+    template <typename T>
+    DAXE_NODISCARD inline size_t simdfind(const T* p, size_t n, T x) noexcept {
+#if DAXE_HAS_SIMD
+        if (simdavailable()) return simdfindkernel(p, n, x);
+#endif
+        return static_cast<size_t>(std::find(p, p + n, x) - p);
+    }
+
+    template <typename T>
+    DAXE_NODISCARD inline size_t simdcount(const T* p, size_t n, T x) noexcept {
+#if DAXE_HAS_SIMD
+        if (simdavailable()) return simdcountkernel(p, n, x);
+#endif
+        return static_cast<size_t>(std::count(p, p + n, x));
+    }
+
+    // Running sum with a carry-in, T must be a scan type
+    template <typename T>
+    inline void simdprefixsum(const T* src, T* dst, size_t n, T carry = T{}) noexcept {
+#if DAXE_HAS_SIMD
+        if (simdavailable()) { simdprefixkernel(src, dst, n, carry); return; }
+#endif
+        for (size_t i = 0; i < n; ++i) dst[i] = carry = static_cast<T>(carry + src[i]);
+    }
+
+    // prefixsumrange - dst[i] = src[0] + ... + src[i] for any T; dst may alias src.
+    // Floating-point stays a sequential loop so results match exactly.
+    template <typename T>
+    inline void prefixsumrange(const T* src, T* dst, size_t n) {
+        if constexpr (issimdscantype<T>) {
+            simdprefixsum(src, dst, n);
+        } else {
+            if (n == 0) return;
+            T acc = src[0];
+            dst[0] = acc;
+            for (size_t i = 1; i < n; ++i) dst[i] = acc = acc + src[i];
+        }
+    }
+
+    // Integer sums only: float addition is not associative
+    template <typename T>
+    DAXE_NODISCARD inline T simdsum(const T* p, size_t n) noexcept {
+#if DAXE_HAS_SIMD
+        if constexpr (std::is_integral_v<T>) {
+            if (simdavailable()) { bool nan; return simdreducekernel<SIMD_SUM>(p, n, nan); }
+        }
+#endif
+        return std::accumulate(p, p + n, T{});
+    }
+
+    // argmax / argmin: reduce to the extreme value, then find its first index
+    template <typename T>
+    DAXE_NODISCARD inline size_t simdargmax(const T* p, size_t n) noexcept {
+#if DAXE_HAS_SIMD
+        if (simdavailable()) {
+            bool nan;
+            const T m = simdreducekernel<SIMD_MAX>(p, n, nan);
+            if (!nan) return simdfindkernel(p, n, m);
+        }
+#endif
+        return static_cast<size_t>(std::max_element(p, p + n) - p);
+    }
+
+    template <typename T>
+    DAXE_NODISCARD inline size_t simdargmin(const T* p, size_t n) noexcept {
+#if DAXE_HAS_SIMD
+        if (simdavailable()) {
+            bool nan;
+            const T m = simdreducekernel<SIMD_MIN>(p, n, nan);
+            if (!nan) return simdfindkernel(p, n, m);
+        }
+#endif
+        return static_cast<size_t>(std::min_element(p, p + n) - p);
+    }
+
+    // max / min values. For floats a zero result is re-read from the array,
+    // so -0.0 vs 0.0 comes out exactly as std::max_element would pick it.
+    template <typename T>
+    DAXE_NODISCARD inline T simdmax(const T* p, size_t n) noexcept {
+#if DAXE_HAS_SIMD
+        if (simdavailable()) {
+            bool nan;
+            const T m = simdreducekernel<SIMD_MAX>(p, n, nan);
+            if (!nan) {
+                if constexpr (std::is_floating_point_v<T>) if (m == T{}) return p[simdfindkernel(p, n, m)];
+                return m;
+            }
+        }
+#endif
+        return *std::max_element(p, p + n);
+    }
+
+    template <typename T>
+    DAXE_NODISCARD inline T simdmin(const T* p, size_t n) noexcept {
+#if DAXE_HAS_SIMD
+        if (simdavailable()) {
+            bool nan;
+            const T m = simdreducekernel<SIMD_MIN>(p, n, nan);
+            if (!nan) {
+                if constexpr (std::is_floating_point_v<T>) if (m == T{}) return p[simdfindkernel(p, n, m)];
+                return m;
+            }
+        }
+#endif
+        return *std::min_element(p, p + n);
+    }
+
+    // minmax: std::minmax_element returns the first smallest and the last largest
+    template <typename T>
+    DAXE_NODISCARD inline std::pair<T, T> simdminmax(const T* p, size_t n) noexcept {
+#if DAXE_HAS_SIMD
+        if (simdavailable()) {
+            bool nan;
+            auto [lo, hi] = simdminmaxkernel(p, n, nan);
+            if (!nan) {
+                if constexpr (std::is_floating_point_v<T>) {
+                    if (lo == T{}) lo = p[simdfindkernel(p, n, lo)];
+                    if (hi == T{}) { size_t i = n; while (!(p[--i] == hi)) {} hi = p[i]; }
+                }
+                return {lo, hi};
+            }
+        }
+#endif
+        auto [lo, hi] = std::minmax_element(p, p + n);
+        return {*lo, *hi};
+    }
+
+    // ==========================================
+    // SEARCH ENTRY POINTS (any container, any value)
+    // ==========================================
+    // The vector kernel runs when the element and the query share a
+    // representation (same type, or e.g. long vs long long); anything else
+    // keeps std::find / std::count comparison semantics.
+    template <typename E, typename U>
+    inline constexpr bool issimdsearchable = issimdsearchtype<E> && std::is_arithmetic_v<U> &&
+        (std::is_same_v<E, U> || (std::is_integral_v<E> && std::is_integral_v<U> && !std::is_same_v<U, bool> &&
+                                  sizeof(E) == sizeof(U) && std::is_signed_v<E> == std::is_signed_v<U>));
+
+    // findin(c, x) -> index of the first x, or size(c)
+    template <typename Container, typename U>
+    DAXE_NODISCARD inline size_t findin(const Container& c, const U& x) noexcept {
+        using E = std::decay_t<decltype(*std::begin(c))>;
+        if constexpr (hasdata<const Container>::value && issimdsearchable<E, U>) {
+            return simdfind(std::data(c), std::size(c), static_cast<E>(x));
+        } else {
+            return static_cast<size_t>(std::distance(std::begin(c), std::find(std::begin(c), std::end(c), x)));
+        }
+    }
+
+    // countin(c, x) -> occurrences of x
+    template <typename Container, typename U>
+    DAXE_NODISCARD inline size_t countin(const Container& c, const U& x) {
+        using E = std::decay_t<decltype(*std::begin(c))>;
+        if constexpr (hasdata<const Container>::value && issimdsearchable<E, U>) {
+            return simdcount(std::data(c), std::size(c), static_cast<E>(x));
+        } else {
+            return static_cast<size_t>(std::count(std::begin(c), std::end(c), x));
+        }
+    }
+
+    // ==========================================
+    // ASCII STRING KERNELS
+    // ==========================================
+    // Bytes below 0x80 are mapped and classified with plain compares. A block
+    // holding any byte >= 0x80 goes byte by byte through <cctype> instead, so
+    // non-ASCII text keeps whatever the current locale says.
+    enum : int { ASCII_ALPHA, ASCII_DIGIT, ASCII_ALNUM };
+
+    template <bool UPPER>
+    DAXE_NODISCARD inline char casebyte(char c) noexcept {
+        const auto u = static_cast<unsigned char>(c);
+        if (u >= 0x80) DAXE_UNLIKELY return static_cast<char>(UPPER ? std::toupper(u) : std::tolower(u));
+        return static_cast<unsigned>(u - (UPPER ? 'a' : 'A')) < 26u ? static_cast<char>(u ^ 0x20) : c;
+    }
+
+    template <int CLASS>
+    DAXE_NODISCARD inline bool classbyte(char c) noexcept {
+        const auto u = static_cast<unsigned char>(c);
+        if (u >= 0x80) DAXE_UNLIKELY {
+            if constexpr (CLASS == ASCII_ALPHA) return std::isalpha(u) != 0;
+            else if constexpr (CLASS == ASCII_DIGIT) return std::isdigit(u) != 0;
+            else return std::isalnum(u) != 0;
+        }
+        const bool digit = static_cast<unsigned>(u - '0') < 10u;
+        const bool alpha = static_cast<unsigned>((u | 0x20) - 'a') < 26u;
+        if constexpr (CLASS == ASCII_ALPHA) return alpha;
+        else if constexpr (CLASS == ASCII_DIGIT) return digit;
+        else return alpha || digit;
+    }
+
+    // std::isspace
+    DAXE_NODISCARD inline bool spacebyte(char c) noexcept {
+        const auto u = static_cast<unsigned char>(c);
+        if (u >= 0x80) DAXE_UNLIKELY return std::isspace(u) != 0;
+        return u == ' ' || static_cast<unsigned>(u - '\t') < 5u;
+    }
+
+    // The set strip() removes
+    DAXE_NODISCARD constexpr bool stripbyte(char c) noexcept { return c == ' ' || c == '\t' || c == '\n' || c == '\r'; }
+
+#if DAXE_SIMD_AVX2
+    // dst[i] = casebyte(src[i]); dst may equal src
+    template <bool UPPER>
+    DAXE_SIMD_TARGET inline void simdcasekernel(const char* src, char* dst, size_t n) noexcept {
+        const __m256i lo = _mm256_set1_epi8(UPPER ? 'a' - 1 : 'A' - 1);
+        const __m256i hi = _mm256_set1_epi8(UPPER ? 'z' + 1 : 'Z' + 1);
+        const __m256i flip = _mm256_set1_epi8(0x20);
+        size_t i = 0;
+        for (; i + 32 <= n; i += 32) {
+            const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+            if (_mm256_movemask_epi8(v)) DAXE_UNLIKELY {
+                for (size_t j = i; j < i + 32; ++j) dst[j] = casebyte<UPPER>(src[j]);
+                continue;
+            }
+            const __m256i letter = _mm256_and_si256(_mm256_cmpgt_epi8(v, lo), _mm256_cmpgt_epi8(hi, v));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), _mm256_xor_si256(v, _mm256_and_si256(letter, flip)));
+        }
+        for (; i < n; ++i) dst[i] = casebyte<UPPER>(src[i]);
+    }
+
+    // Does every byte of p[0, n) belong to CLASS?
+    template <int CLASS>
+    DAXE_SIMD_TARGET inline bool simdclasskernel(const char* p, size_t n) noexcept {
+        const __m256i fold = _mm256_set1_epi8(0x20);
+        size_t i = 0;
+        for (; i + 32 <= n; i += 32) {
+            const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + i));
+            if (_mm256_movemask_epi8(v)) DAXE_UNLIKELY {
+                for (size_t j = i; j < i + 32; ++j) if (!classbyte<CLASS>(p[j])) return false;
+                continue;
+            }
+            const __m256i digit = _mm256_and_si256(_mm256_cmpgt_epi8(v, _mm256_set1_epi8('0' - 1)), _mm256_cmpgt_epi8(_mm256_set1_epi8('9' + 1), v));
+            const __m256i f = _mm256_or_si256(v, fold);
+            const __m256i alpha = _mm256_and_si256(_mm256_cmpgt_epi8(f, _mm256_set1_epi8('a' - 1)), _mm256_cmpgt_epi8(_mm256_set1_epi8('z' + 1), f));
+            __m256i ok;
+            if constexpr (CLASS == ASCII_ALPHA) ok = alpha;
+            else if constexpr (CLASS == ASCII_DIGIT) ok = digit;
+            else ok = _mm256_or_si256(alpha, digit);
+            if (_mm256_movemask_epi8(ok) != -1) return false;
+        }
+        for (; i < n; ++i) if (!classbyte<CLASS>(p[i])) return false;
+        return true;
+    }
+
+    DAXE_SIMD_TARGET inline u32 stripmask(const char* p) noexcept {
+        const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+        const __m256i m = _mm256_or_si256(_mm256_or_si256(_mm256_cmpeq_epi8(v, _mm256_set1_epi8(' ')), _mm256_cmpeq_epi8(v, _mm256_set1_epi8('\t'))),
+                                          _mm256_or_si256(_mm256_cmpeq_epi8(v, _mm256_set1_epi8('\n')), _mm256_cmpeq_epi8(v, _mm256_set1_epi8('\r'))));
+        return static_cast<u32>(_mm256_movemask_epi8(m));
+    }
+
+    // First position in p[0, n) outside the strip set, or n
+    DAXE_SIMD_TARGET inline size_t simdskipstripkernel(const char* p, size_t n) noexcept {
+        size_t i = 0;
+        for (; i + 32 <= n; i += 32) {
+            const u32 m = ~stripmask(p + i);
+            if (m) return i + static_cast<size_t>(trailingzeros(m));
+        }
+        for (; i < n; ++i) if (!stripbyte(p[i])) return i;
+        return n;
+    }
+
+    // One past the last position in p[0, n) outside the strip set, or 0
+    DAXE_SIMD_TARGET inline size_t simdskipstripbackkernel(const char* p, size_t n) noexcept {
+        size_t e = n;
+        for (; e >= 32; e -= 32) {
+            const u32 m = ~stripmask(p + e - 32);
+            if (m) return e - static_cast<size_t>(leadingzeros(m) - 32);
+        }
+        for (; e > 0; --e) if (!stripbyte(p[e - 1])) return e;
+        return 0;
+    }
+#elif DAXE_SIMD_NEON
+    template <bool UPPER>
+    inline void simdcasekernel(const char* src, char* dst, size_t n) noexcept {
+        const uint8x16_t lo = vdupq_n_u8(UPPER ? 'a' : 'A'), hi = vdupq_n_u8(UPPER ? 'z' : 'Z'), flip = vdupq_n_u8(0x20);
+        size_t i = 0;
+        for (; i + 16 <= n; i += 16) {
+            const uint8x16_t v = vld1q_u8(reinterpret_cast<const u8*>(src + i));
+            if (vmaxvq_u8(v) >= 0x80) DAXE_UNLIKELY {
+                for (size_t j = i; j < i + 16; ++j) dst[j] = casebyte<UPPER>(src[j]);
+                continue;
+            }
+            const uint8x16_t letter = vandq_u8(vcgeq_u8(v, lo), vcleq_u8(v, hi));
+            vst1q_u8(reinterpret_cast<u8*>(dst + i), veorq_u8(v, vandq_u8(letter, flip)));
+        }
+        for (; i < n; ++i) dst[i] = casebyte<UPPER>(src[i]);
+    }
+
+    template <int CLASS>
+    inline bool simdclasskernel(const char* p, size_t n) noexcept {
+        size_t i = 0;
+        for (; i + 16 <= n; i += 16) {
+            const uint8x16_t v = vld1q_u8(reinterpret_cast<const u8*>(p + i));
+            if (vmaxvq_u8(v) >= 0x80) DAXE_UNLIKELY {
+                for (size_t j = i; j < i + 16; ++j) if (!classbyte<CLASS>(p[j])) return false;
+                continue;
+            }
+            const uint8x16_t digit = vandq_u8(vcgeq_u8(v, vdupq_n_u8('0')), vcleq_u8(v, vdupq_n_u8('9')));
+            const uint8x16_t f = vorrq_u8(v, vdupq_n_u8(0x20));
+            const uint8x16_t alpha = vandq_u8(vcgeq_u8(f, vdupq_n_u8('a')), vcleq_u8(f, vdupq_n_u8('z')));
+            uint8x16_t ok;
+            if constexpr (CLASS == ASCII_ALPHA) ok = alpha;
+            else if constexpr (CLASS == ASCII_DIGIT) ok = digit;
+            else ok = vorrq_u8(alpha, digit);
+            if (vminvq_u8(ok) != 0xFF) return false;
+        }
+        for (; i < n; ++i) if (!classbyte<CLASS>(p[i])) return false;
+        return true;
+    }
+
+    // No movemask on NEON: find the block that is not all strip bytes, then scan it
+    inline bool allstrip(const char* p) noexcept {
+        const uint8x16_t v = vld1q_u8(reinterpret_cast<const u8*>(p));
+        const uint8x16_t m = vorrq_u8(vorrq_u8(vceqq_u8(v, vdupq_n_u8(' ')), vceqq_u8(v, vdupq_n_u8('\t'))),
+                                      vorrq_u8(vceqq_u8(v, vdupq_n_u8('\n')), vceqq_u8(v, vdupq_n_u8('\r'))));
+        return vminvq_u8(m) == 0xFF;
+    }
+
+    inline size_t simdskipstripkernel(const char* p, size_t n) noexcept {
+        size_t i = 0;
+        while (i + 16 <= n && allstrip(p + i)) i += 16;
+        for (; i < n; ++i) if (!stripbyte(p[i])) return i;
+        return n;
+    }
+
+    inline size_t simdskipstripbackkernel(const char* p, size_t n) noexcept {
+        size_t e = n;
+        while (e >= 16 && allstrip(p + e - 16)) e -= 16;
+        for (; e > 0; --e) if (!stripbyte(p[e - 1])) return e;
+        return 0;
+    }
+#endif
+
+    template <bool UPPER>
+    inline void asciicase(const char* src, char* dst, size_t n) noexcept {
+#if DAXE_HAS_SIMD
+        if (simdavailable()) { simdcasekernel<UPPER>(src, dst, n); return; }
+#endif
+        for (size_t i = 0; i < n; ++i) dst[i] = casebyte<UPPER>(src[i]);
+    }
+
+    template <int CLASS>
+    DAXE_NODISCARD inline bool asciiall(const char* p, size_t n) noexcept {
+#if DAXE_HAS_SIMD
+        if (simdavailable()) return simdclasskernel<CLASS>(p, n);
+#endif
+        for (size_t i = 0; i < n; ++i) if (!classbyte<CLASS>(p[i])) return false;
+        return true;
+    }
+
+    DAXE_NODISCARD inline size_t skipstrip(const char* p, size_t n) noexcept {
+#if DAXE_HAS_SIMD
+        if (simdavailable()) return simdskipstripkernel(p, n);
+#endif
+        size_t i = 0;
+        while (i < n && stripbyte(p[i])) ++i;
+        return i;
+    }
+
+    DAXE_NODISCARD inline size_t skipstripback(const char* p, size_t n) noexcept {
+#if DAXE_HAS_SIMD
+        if (simdavailable()) return simdskipstripbackkernel(p, n);
+#endif
+        while (n > 0 && stripbyte(p[n - 1])) --n;
+        return n;
+    }
+
+    // ==========================================
+    // VECTOR ENTRY POINTS (any T, non-empty for min/max)
+    // ==========================================
+    template <typename T>
+    DAXE_NODISCARD inline T sumof(const std::vector<T>& v) noexcept {
+        if constexpr (issimdtype<T>) return simdsum(v.data(), v.size());
+        else return std::accumulate(v.begin(), v.end(), T{});
+    }
+
+    template <typename T>
+    DAXE_NODISCARD inline T maxof(const std::vector<T>& v) {
+        if constexpr (issimdtype<T>) return simdmax(v.data(), v.size());
+        else return *std::max_element(v.begin(), v.end());
+    }
+
+    template <typename T>
+    DAXE_NODISCARD inline T minof(const std::vector<T>& v) {
+        if constexpr (issimdtype<T>) return simdmin(v.data(), v.size());
+        else return *std::min_element(v.begin(), v.end());
+    }
+
+    template <typename T>
+    DAXE_NODISCARD inline std::pair<T, T> minmaxof(const std::vector<T>& v) {
+        if constexpr (issimdtype<T>) return simdminmax(v.data(), v.size());
+        else { auto [lo, hi] = std::minmax_element(v.begin(), v.end()); return {*lo, *hi}; }
+    }
+
+    template <typename T>
+    DAXE_NODISCARD inline i64 argmaxof(const std::vector<T>& v) {
+        if constexpr (issimdtype<T>) return static_cast<i64>(simdargmax(v.data(), v.size()));
+        else return static_cast<i64>(std::max_element(v.begin(), v.end()) - v.begin());
+    }
+
+    template <typename T>
+    DAXE_NODISCARD inline i64 argminof(const std::vector<T>& v) {
+        if constexpr (issimdtype<T>) return static_cast<i64>(simdargmin(v.data(), v.size()));
+        else return static_cast<i64>(std::min_element(v.begin(), v.end()) - v.begin());
+    }
+}
+
+DAXE_NAMESPACE_END
+
+#endif // DAXE_SIMD_H
@@ -0,0 +1,410 @@
+/*
+ * DAXE - INLINE CONTAINERS
+ * D.A's Axe - Cut through C++ verbosity
+ *
+ * SmallList<T, N> - List that keeps up to N elements inside the object and
+ * moves to the heap only when it outgrows them. Adjacency lists of small
+ * degree and per-node move lists then cost no allocation at all.
+ * StaticVec<T, N> - fixed capacity N, never allocates; going past N panics.
+ *
+ * Both carry the List methods (append, pop, extend, insertat, remove,
+ * indexof, slice, sum, filter, ...) and iterate as plain pointers.
+ *
+ *   std::vector<SmallList<i32, 4>> adj(n);
+ *   adj[u].append(v);
+ *
+ * Naming: Flat style (no snake_case)
+ */
+
+#ifndef DAXE_SMALLVEC_H
+#define DAXE_SMALLVEC_H
+
+#include "base.h"
+#include "safe.h"
+#include "sort.h"
+#include "simd.h"
+#include "pythonic.h"
+#include <algorithm>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <new>
+#include <numeric>
+#include <type_traits>
+#include <utility>
+
+#if DAXE_HAS_SPAN
+#include <span>
+#endif
+
+DAXE_NAMESPACE_BEGIN
+
+namespace detail {
+    // ==========================================
+    // LIST METHODS OVER CONTIGUOUS STORAGE
+    // ==========================================
+    // Derived owns the storage and provides data(), size(), capacity() and
+    // two hooks: makeroom(n) to guarantee capacity >= n (grow or panic) and
+    // setsize(n). Everything else, including the element bookkeeping, is here.
+    template <typename Derived, typename T>
+    class ListMethods {
+        DAXE_NODISCARD Derived& self() noexcept { return static_cast<Derived&>(*this); }
+        DAXE_NODISCARD const Derived& self() const noexcept { return static_cast<const Derived&>(*this); }
+        DAXE_NODISCARD T* ptr() noexcept { return self().data(); }
+        DAXE_NODISCARD const T* ptr() const noexcept { return self().data(); }
+        DAXE_NODISCARD size_t used() const noexcept { return self().size(); }
+
+    public:
+        using value_type = T;
+        using size_type = size_t;
+        using iterator = T*;
+        using const_iterator = const T*;
+        using reverse_iterator = std::reverse_iterator<T*>;
+        using const_reverse_iterator = std::reverse_iterator<const T*>;
+
+        DAXE_NODISCARD T* begin() noexcept { return ptr(); }
+        DAXE_NODISCARD T* end() noexcept { return ptr() + used(); }
+        DAXE_NODISCARD const T* begin() const noexcept { return ptr(); }
+        DAXE_NODISCARD const T* end() const noexcept { return ptr() + used(); }
+        DAXE_NODISCARD reverse_iterator rbegin() noexcept { return reverse_iterator(end()); }
+        DAXE_NODISCARD reverse_iterator rend() noexcept { return reverse_iterator(begin()); }
+        DAXE_NODISCARD const_reverse_iterator rbegin() const noexcept { return const_reverse_iterator(end()); }
+        DAXE_NODISCARD const_reverse_iterator rend() const noexcept { return const_reverse_iterator(begin()); }
+
+        DAXE_NODISCARD bool empty() const noexcept { return used() == 0; }
+        DAXE_NODISCARD T& operator[](size_t i) noexcept { return ptr()[i]; }
+        DAXE_NODISCARD const T& operator[](size_t i) const noexcept { return ptr()[i]; }
+        DAXE_NODISCARD T& at(size_t i) { if (i >= used()) DAXE_UNLIKELY panic("index out of range"); return ptr()[i]; }
+        DAXE_NODISCARD const T& at(size_t i) const { if (i >= used()) DAXE_UNLIKELY panic("index out of range"); return ptr()[i]; }
+        DAXE_NODISCARD T& front() noexcept { return ptr()[0]; }
+        DAXE_NODISCARD T& back() noexcept { return ptr()[used() - 1]; }
+        DAXE_NODISCARD const T& front() const noexcept { return ptr()[0]; }
+        DAXE_NODISCARD const T& back() const noexcept { return ptr()[used() - 1]; }
+
+        void reserve(size_t n) { if (n > self().capacity()) self().makeroom(n); }
+
+        template <typename... Args>
+        T& emplace_back(Args&&... args) {
+            const size_t n = used();
+            if (n == self().capacity()) DAXE_UNLIKELY {
+                T x(std::forward<Args>(args)...);   // args may alias an element
+                self().makeroom(n + 1);
+                ::new (static_cast<void*>(ptr() + n)) T(std::move(x));
+            } else {
+                ::new (static_cast<void*>(ptr() + n)) T(std::forward<Args>(args)...);
+            }
+            self().setsize(n + 1);
+            return ptr()[n];
+        }
+        void push_back(const T& x) { emplace_back(x); }
+        void push_back(T&& x) { emplace_back(std::move(x)); }
+        void pop_back() noexcept { const size_t n = used() - 1; std::destroy_at(ptr() + n); self().setsize(n); }
+
+        T* insert(const T* pos, T x) {
+            const size_t i = static_cast<size_t>(pos - ptr()), n = used();
+            self().makeroom(n + 1);
+            T* p = ptr();
+            if (i == n) {
+                ::new (static_cast<void*>(p + n)) T(std::move(x));
+            } else {
+                ::new (static_cast<void*>(p + n)) T(std::move(p[n - 1]));
+                std::move_backward(p + i, p + n - 1, p + n);
+                p[i] = std::move(x);
+            }
+            self().setsize(n + 1);
+            return p + i;
+        }
+        T* erase(const T* first, const T* last) noexcept {
+            T* p = ptr();
+            T* const a = p + (first - p);
+            T* const b = p + (last - p);
+            T* const e = std::move(b, p + used(), a);
+            std::destroy(e, p + used());
+            self().setsize(static_cast<size_t>(e - p));
+            return a;
+        }
+        T* erase(const T* pos) noexcept { return erase(pos, pos + 1); }
+        void clear() noexcept { std::destroy(ptr(), ptr() + used()); self().setsize(0); }
+
+        void resize(size_t n, const T& fill = T{}) {
+            const size_t m = used();
+            if (n <= m) { std::destroy(ptr() + n, ptr() + m); self().setsize(n); return; }
+            if (n > self().capacity()) {
+                const T value = fill;   // fill may alias an element
+                self().makeroom(n);
+                std::uninitialized_fill(ptr() + m, ptr() + n, value);
+            } else {
+                std::uninitialized_fill(ptr() + m, ptr() + n, fill);
+            }
+            self().setsize(n);
+        }
+
+        template <typename Range>
+        void assign(const Range& r) {
+            clear();
+            for (const auto& x : r) emplace_back(x);
+        }
+
+        DAXE_NODISCARD bool operator==(const ListMethods& other) const {
+            return used() == other.used() && std::equal(begin(), end(), other.begin());
+        }
+        DAXE_NODISCARD bool operator!=(const ListMethods& other) const { return !(*this == other); }
+
+        // ---- List surface ----
+        template <typename U> void append(U&& x) { emplace_back(std::forward<U>(x)); }
+
+        DAXE_NODISCARD Option<T> pop() {
+            if (empty()) DAXE_UNLIKELY return None;
+            T val = std::move(back()); pop_back();
+            return Some(std::move(val));
+        }
+        DAXE_NODISCARD T pop(const T& fallback) {
+            if (empty()) DAXE_UNLIKELY return fallback;
+            T val = std::move(back()); pop_back();
+            return val;
+        }
+
+        template <typename Range>
+        void extend(const Range& other) {
+            reserve(used() + static_cast<size_t>(std::size(other)));
+            for (const auto& x : other) emplace_back(x);
+        }
+
+        void insertat(i64 idx, const T& x) {
+            const i64 n = static_cast<i64>(used());
+            if (idx < 0) idx += n;
+            if (idx < 0) idx = 0;
+            if (idx > n) idx = n;
+            insert(begin() + idx, x);
+        }
+        bool remove(const T& x) noexcept {
+            const size_t i = detail::findin(self(), x);
+            if (i != used()) DAXE_LIKELY { erase(begin() + i); return true; }
+            return false;
+        }
+        void removeat(i64 idx) noexcept {
+            if (idx < 0) idx += static_cast<i64>(used());
+            if (idx >= 0 && idx < static_cast<i64>(used())) erase(begin() + idx);
+        }
+
+        DAXE_NODISCARD i64 indexof(const T& x) const noexcept {
+            const size_t i = detail::findin(self(), x);
+            return i != used() ? static_cast<i64>(i) : -1;
+        }
+        DAXE_NODISCARD i64 count(const T& x) const noexcept { return static_cast<i64>(detail::countin(self(), x)); }
+        DAXE_NODISCARD bool has(const T& x) const noexcept { return detail::findin(self(), x) != used(); }
+
+        void sort() { detail::sortcontainer(self()); }
+        void rsort() { detail::sortcontainerdesc(self()); }
+        void reverse() noexcept { std::reverse(begin(), end()); }
+
+        DAXE_NODISCARD Derived sorted() const { Derived copy = self(); copy.sort(); return copy; }
+        DAXE_NODISCARD Derived reversed() const { Derived copy = self(); copy.reverse(); return copy; }
+
+        DAXE_NODISCARD Derived slice(i64 start, i64 end) const {
+            if (!detail::normalizeslice(start, end, static_cast<i64>(used()))) DAXE_UNLIKELY return {};
+            return Derived(begin() + start, begin() + end);
+        }
+#if DAXE_HAS_SPAN
+        // sliceview - slice() without the copy; valid until the list is resized or moved
+        DAXE_NODISCARD std::span<const T> sliceview(i64 start, i64 end) const noexcept {
+            if (!detail::normalizeslice(start, end, static_cast<i64>(used()))) DAXE_UNLIKELY return {};
+            return std::span<const T>(ptr() + start, static_cast<size_t>(end - start));
+        }
+#endif
+
+        DAXE_NODISCARD Option<T> getat(i64 idx) const noexcept {
+            if (idx < 0) idx += static_cast<i64>(used());
+            if (idx < 0 || idx >= static_cast<i64>(used())) DAXE_UNLIKELY return None;
+            return Some(ptr()[idx]);
+        }
+        DAXE_NODISCARD T getor(i64 idx, const T& def) const noexcept {
+            if (idx < 0) idx += static_cast<i64>(used());
+            if (idx < 0 || idx >= static_cast<i64>(used())) DAXE_UNLIKELY return def;
+            return ptr()[idx];
+        }
+
+        DAXE_NODISCARD T sum() const noexcept {
+            if constexpr (issimdtype<T>) return simdsum(ptr(), used());
+            else return std::accumulate(begin(), end(), T{});
+        }
+        DAXE_NODISCARD Option<T> max() const { if (empty()) return None; return Some(maxvalue()); }
+        DAXE_NODISCARD Option<T> min() const { if (empty()) return None; return Some(minvalue()); }
+        DAXE_NODISCARD T max(const T& fallback) const { if (empty()) return fallback; return maxvalue(); }
+        DAXE_NODISCARD T min(const T& fallback) const { if (empty()) return fallback; return minvalue(); }
+
+        template <typename Func>
+        DAXE_NODISCARD Derived filter(Func&& f) const {
+            Derived result;
+            for (const auto& x : *this) if (f(x)) result.push_back(x);
+            return result;
+        }
+        template <typename Func>
+        DAXE_NODISCARD auto transform(Func&& f) const {
+            using U = decltype(f(std::declval<T>()));
+            typename Derived::template rebind<U> result;
+            result.reserve(used());
+            for (const auto& x : *this) result.push_back(f(x));
+            return result;
+        }
+
+        template <typename Func> DAXE_NODISCARD bool any(Func&& f) const noexcept { for (const auto& x : *this) if (f(x)) DAXE_LIKELY return true; return false; }
+        template <typename Func> DAXE_NODISCARD bool every(Func&& f) const noexcept { for (const auto& x : *this) if (!f(x)) DAXE_UNLIKELY return false; return true; }
+        template <typename Func> DAXE_NODISCARD bool none(Func&& f) const noexcept { return !any(std::forward<Func>(f)); }
+
+        void unique() { erase(std::unique(begin(), end()), end()); }
+
+        DAXE_NODISCARD List<T> tolist() const { return List<T>(begin(), end()); }
+
+    private:
+        DAXE_NODISCARD T maxvalue() const {
+            if constexpr (issimdtype<T>) return simdmax(ptr(), used());
+            else return *std::max_element(begin(), end());
+        }
+        DAXE_NODISCARD T minvalue() const {
+            if constexpr (issimdtype<T>) return simdmin(ptr(), used());
+            else return *std::min_element(begin(), end());
+        }
+    };
+
+    template <typename It>
+    using ifiterator = std::enable_if_t<!std::is_integral_v<It>, int>;
+}
+
+// ==========================================
+// SMALLLIST CLASS
+// ==========================================
+// sizeof is N * sizeof(T) + 16. Moving an inline list moves its elements;
+// moving a spilled one steals the heap block.
+template <typename T, size_t N = 8>
+class SmallList : public detail::ListMethods<SmallList<T, N>, T> {
+    static_assert(N > 0, "SmallList needs at least one inline slot");
+    friend class detail::ListMethods<SmallList<T, N>, T>;
+
+    T* ptr_;
+    u32 size_ = 0;
+    u32 cap_ = static_cast<u32>(N);
+    alignas(T) unsigned char buf_[N * sizeof(T)];
+
+    DAXE_NODISCARD T* local() noexcept { return std::launder(reinterpret_cast<T*>(buf_)); }
+
+    void setsize(size_t n) noexcept { size_ = static_cast<u32>(n); }
+
+    void makeroom(size_t n) {
+        if (n <= cap_) DAXE_LIKELY return;
+        if (n > std::numeric_limits<u32>::max()) DAXE_UNLIKELY panic("SmallList: more than 2^32 - 1 elements");
+        const size_t cap = std::min<size_t>(std::max<size_t>(n, 2 * size_t{cap_}), std::numeric_limits<u32>::max());
+        T* p = std::allocator<T>().allocate(cap);
+        std::uninitialized_move(ptr_, ptr_ + size_, p);
+        std::destroy(ptr_, ptr_ + size_);
+        release();
+        ptr_ = p;
+        cap_ = static_cast<u32>(cap);
+    }
+
+    void release() noexcept { if (spilled()) std::allocator<T>().deallocate(ptr_, cap_); }
+
+    // Takes other's elements; *this must be empty and inline
+    void steal(SmallList& other) noexcept(std::is_nothrow_move_constructible_v<T>) {
+        if (other.spilled()) {
+            ptr_ = other.ptr_;
+            cap_ = other.cap_;
+            other.ptr_ = other.local();
+            other.cap_ = static_cast<u32>(N);
+        } else {
+            std::uninitialized_move(other.ptr_, other.ptr_ + other.size_, ptr_);
+            std::destroy(other.ptr_, other.ptr_ + other.size_);
+        }
+        size_ = other.size_;
+        other.size_ = 0;
+    }
+
+public:
+    template <typename U> using rebind = SmallList<U, N>;
+
+    SmallList() noexcept : ptr_(local()) {}
+    explicit SmallList(size_t n, const T& fill = T{}) : ptr_(local()) { this->resize(n, fill); }
+    SmallList(std::initializer_list<T> init) : ptr_(local()) { this->extend(init); }
+    template <typename It, detail::ifiterator<It> = 0>
+    SmallList(It first, It last) : ptr_(local()) { for (; first != last; ++first) this->emplace_back(*first); }
+
+    SmallList(const SmallList& other) : ptr_(local()) { this->extend(other); }
+    SmallList(SmallList&& other) noexcept(std::is_nothrow_move_constructible_v<T>) : ptr_(local()) { steal(other); }
+    SmallList& operator=(const SmallList& other) {
+        if (this != &other) { this->clear(); this->extend(other); }
+        return *this;
+    }
+    SmallList& operator=(SmallList&& other) noexcept(std::is_nothrow_move_constructible_v<T>) {
+        if (this != &other) {
+            this->clear();
+            release();
+            ptr_ = local();
+            cap_ = static_cast<u32>(N);
+            steal(other);
+        }
+        return *this;
+    }
+    ~SmallList() { this->clear(); release(); }
+
+    DAXE_NODISCARD T* data() noexcept { return ptr_; }
+    DAXE_NODISCARD const T* data() const noexcept { return ptr_; }
+    DAXE_NODISCARD size_t size() const noexcept { return size_; }
+    DAXE_NODISCARD size_t capacity() const noexcept { return cap_; }
+    // True once the elements live on the heap
+    DAXE_NODISCARD bool spilled() const noexcept { return ptr_ != reinterpret_cast<const T*>(buf_); }
+};
+
+// ==========================================
+// STATICVEC CLASS
+// ==========================================
+template <typename T, size_t N>
+class StaticVec : public detail::ListMethods<StaticVec<T, N>, T> {
+    friend class detail::ListMethods<StaticVec<T, N>, T>;
+
+    size_t size_ = 0;
+    alignas(T) unsigned char buf_[N * sizeof(T) > 0 ? N * sizeof(T) : 1];
+
+    void setsize(size_t n) noexcept { size_ = n; }
+    void makeroom(size_t n) const { if (n > N) DAXE_UNLIKELY panic("StaticVec: capacity " + std::to_string(N) + " exceeded"); }
+
+public:
+    template <typename U> using rebind = StaticVec<U, N>;
+
+    StaticVec() noexcept = default;
+    explicit StaticVec(size_t n, const T& fill = T{}) { this->resize(n, fill); }
+    StaticVec(std::initializer_list<T> init) { this->extend(init); }
+    template <typename It, detail::ifiterator<It> = 0>
+    StaticVec(It first, It last) { for (; first != last; ++first) this->emplace_back(*first); }
+
+    StaticVec(const StaticVec& other) { this->extend(other); }
+    StaticVec(StaticVec&& other) noexcept(std::is_nothrow_move_constructible_v<T>) {
+        std::uninitialized_move(other.begin(), other.end(), data());
+        size_ = other.size_;
+        other.clear();
+    }
+    StaticVec& operator=(const StaticVec& other) {
+        if (this != &other) { this->clear(); this->extend(other); }
+        return *this;
+    }
+    StaticVec& operator=(StaticVec&& other) noexcept(std::is_nothrow_move_constructible_v<T>) {
+        if (this != &other) {
+            this->clear();
+            std::uninitialized_move(other.begin(), other.end(), data());
+            size_ = other.size_;
+            other.clear();
+        }
+        return *this;
+    }
+    ~StaticVec() { this->clear(); }
+
+    DAXE_NODISCARD T* data() noexcept { return std::launder(reinterpret_cast<T*>(buf_)); }
+    DAXE_NODISCARD const T* data() const noexcept { return std::launder(reinterpret_cast<const T*>(buf_)); }
+    DAXE_NODISCARD size_t size() const noexcept { return size_; }
+    DAXE_NODISCARD static constexpr size_t capacity() noexcept { return N; }
+    DAXE_NODISCARD bool full() const noexcept { return size_ == N; }
+};
+
+DAXE_NAMESPACE_END
+
+#endif // DAXE_SMALLVEC_H
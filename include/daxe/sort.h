@@ -0,0 +1,449 @@
+/*
+ * DAXE - SORTING
+ * D.A's Axe - Cut through C++ verbosity
+ *
+ * radixsort(v) - LSD radix sort for integers, pairs and tuples of integers.
+ * sorted(), sortasc, sortdesc, uniquify and List::sort dispatch here
+ * automatically once the input is large enough.
+ *
+ * argsort / sortby - key computed once per element, sorted next to its index.
+ * compress - coordinate compression in one sort plus a linear pass.
+ */
+
+#ifndef DAXE_SORT_H
+#define DAXE_SORT_H
+
+#include "base.h"
+#include "safe.h"
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// Below this many elements std::sort wins over radix passes
+#ifndef DAXE_RADIX_THRESHOLD
+    #define DAXE_RADIX_THRESHOLD 2048
+#endif
+
+DAXE_NAMESPACE_BEGIN
+
+namespace detail {
+    // ==========================================
+    // RADIX KEYS
+    // ==========================================
+    // RadixKey<T>::byte(x, k) is byte k (least significant first) of an
+    // unsigned key whose order matches operator< on T.
+    template <typename T, typename = void>
+    struct RadixKey {
+        static constexpr bool enabled = false;
+        static constexpr int BYTES = 0;
+    };
+
+    // Integers: flip the sign bit so negatives order before positives
+    template <typename T>
+    struct RadixKey<T, std::enable_if_t<std::is_integral_v<T> && !std::is_same_v<T, bool> && (sizeof(T) <= 8)>> {
+        static constexpr bool enabled = true;
+        static constexpr int BYTES = sizeof(T);
+        using U = std::make_unsigned_t<T>;
+
+        DAXE_ALWAYS_INLINE static constexpr U key(T x) noexcept {
+            if constexpr (std::is_signed_v<T>) return static_cast<U>(static_cast<U>(x) ^ (U{1} << (sizeof(T) * 8 - 1)));
+            else return static_cast<U>(x);
+        }
+        DAXE_ALWAYS_INLINE static constexpr u8 byte(const T& x, int k) noexcept {
+            return static_cast<u8>(key(x) >> (8 * k));
+        }
+    };
+
+    // Pairs: `second` holds the low bytes, `first` the high bytes
+    template <typename A, typename B>
+    struct RadixKey<std::pair<A, B>, std::enable_if_t<RadixKey<A>::enabled && RadixKey<B>::enabled>> {
+        static constexpr bool enabled = true;
+        static constexpr int BYTES = RadixKey<A>::BYTES + RadixKey<B>::BYTES;
+
+        DAXE_ALWAYS_INLINE static constexpr u8 byte(const std::pair<A, B>& x, int k) noexcept {
+            return k < RadixKey<B>::BYTES ? RadixKey<B>::byte(x.second, k) : RadixKey<A>::byte(x.first, k - RadixKey<B>::BYTES);
+        }
+    };
+
+    // Tuples: the last element holds the lowest bytes
+    template <typename... Ts>
+    struct RadixKey<std::tuple<Ts...>, std::enable_if_t<(sizeof...(Ts) > 0) && (RadixKey<Ts>::enabled && ...)>> {
+        static constexpr bool enabled = true;
+        static constexpr int BYTES = (RadixKey<Ts>::BYTES + ...);
+
+        template <size_t I>
+        DAXE_ALWAYS_INLINE static constexpr u8 bytefrom(const std::tuple<Ts...>& x, int k) noexcept {
+            using E = std::tuple_element_t<I, std::tuple<Ts...>>;
+            if constexpr (I == 0) return RadixKey<E>::byte(std::get<0>(x), k);
+            else {
+                if (k < RadixKey<E>::BYTES) return RadixKey<E>::byte(std::get<I>(x), k);
+                return bytefrom<I - 1>(x, k - RadixKey<E>::BYTES);
+            }
+        }
+        DAXE_ALWAYS_INLINE static constexpr u8 byte(const std::tuple<Ts...>& x, int k) noexcept {
+            return bytefrom<sizeof...(Ts) - 1>(x, k);
+        }
+    };
+
+    // ==========================================
+    // RADIX KERNEL
+    // ==========================================
+    // Above this size the top byte is split first (MSD), so the remaining
+    // LSD passes run on cache-sized buckets
+    inline constexpr size_t RADIX_MSD_THRESHOLD = 1 << 17;
+
+    // LSD passes over bytes [0, hi) of src[0, n); tmp is scratch of the same size.
+    // Stable. The sorted result always ends up in src.
+    template <typename T, typename KeyOf>
+    inline void radixlsd(T* src, T* tmp, size_t n, int hi, KeyOf& keyof, std::vector<size_t>& counts) {
+        using K = std::decay_t<decltype(keyof(*src))>;
+        if (n < 2 || hi <= 0) return;
+        counts.assign(static_cast<size_t>(hi) * 256, 0);
+        for (size_t i = 0; i < n; ++i) {
+            const K& key = keyof(src[i]);
+            for (int k = 0; k < hi; ++k) ++counts[static_cast<size_t>(k) * 256 + RadixKey<K>::byte(key, k)];
+        }
+        T* const home = src;
+        for (int k = 0; k < hi; ++k) {
+            size_t* count = counts.data() + static_cast<size_t>(k) * 256;
+            if (count[RadixKey<K>::byte(keyof(src[0]), k)] == n) continue;  // trivial pass
+            size_t offset = 0;
+            for (int b = 0; b < 256; ++b) { size_t c = count[b]; count[b] = offset; offset += c; }
+            for (size_t i = 0; i < n; ++i) tmp[count[RadixKey<K>::byte(keyof(src[i]), k)]++] = std::move(src[i]);
+            std::swap(src, tmp);
+        }
+        if (src != home) std::move(src, src + n, home);
+    }
+
+    // Sorts data[0, n) by the radix key of keyof(x), stable.
+    // Passes whose byte is the same for every element are skipped.
+    template <typename T, typename KeyOf>
+    inline void radixsortby(T* data, size_t n, KeyOf&& keyof) {
+        using K = std::decay_t<decltype(keyof(*data))>;
+        constexpr int BYTES = RadixKey<K>::BYTES;
+        if (n < 2) return;
+        std::vector<T> buffer(n);
+        std::vector<size_t> counts;
+        if (n < RADIX_MSD_THRESHOLD || BYTES == 1) { radixlsd(data, buffer.data(), n, BYTES, keyof, counts); return; }
+
+        // One histogram pass over every byte finds the highest byte that varies
+        counts.assign(static_cast<size_t>(BYTES) * 256, 0);
+        for (size_t i = 0; i < n; ++i) {
+            const K& key = keyof(data[i]);
+            for (int k = 0; k < BYTES; ++k) ++counts[static_cast<size_t>(k) * 256 + RadixKey<K>::byte(key, k)];
+        }
+        int top = BYTES - 1;
+        while (top >= 0 && counts[static_cast<size_t>(top) * 256 + RadixKey<K>::byte(keyof(data[0]), top)] == n) --top;
+        if (top < 0) return;  // all keys equal
+        std::vector<size_t> bucket(counts.begin() + top * 256, counts.begin() + (top + 1) * 256);
+
+        // MSD split on the top byte, then LSD inside each bucket
+        size_t offset = 0;
+        for (auto& c : bucket) { size_t x = c; c = offset; offset += x; }
+        std::vector<size_t> start(bucket);
+        for (size_t i = 0; i < n; ++i) buffer[bucket[RadixKey<K>::byte(keyof(data[i]), top)]++] = std::move(data[i]);
+        for (size_t b = 0; b < 256; ++b) {
+            const size_t lo = start[b], hi = bucket[b];
+            radixlsd(buffer.data() + lo, data + lo, hi - lo, top, keyof, counts);
+        }
+        std::move(buffer.begin(), buffer.end(), data);
+    }
+
+    template <typename T>
+    inline constexpr bool isradixsortable = RadixKey<T>::enabled;
+
+    template <typename C, typename = void>
+    struct hasdata : std::false_type {};
+
+    template <typename C>
+    struct hasdata<C, std::void_t<decltype(std::data(std::declval<C&>()))>>
+        : std::is_pointer<decltype(std::data(std::declval<C&>()))> {};
+
+    // sortrange - the single entry point used by sorted(), sortasc, List::sort
+    template <typename T>
+    inline void sortrange(T* data, size_t n) {
+        if constexpr (isradixsortable<T>) {
+            if (n >= DAXE_RADIX_THRESHOLD) { radixsortby(data, n, [](const T& x) -> const T& { return x; }); return; }
+        }
+        std::sort(data, data + n);
+    }
+
+    template <typename Container>
+    inline void sortcontainer(Container& c) {
+        if constexpr (hasdata<Container>::value) sortrange(std::data(c), std::size(c));
+        else std::sort(std::begin(c), std::end(c));
+    }
+
+    template <typename Container>
+    inline void sortcontainerdesc(Container& c) {
+        using T = std::decay_t<decltype(*std::begin(c))>;
+        if constexpr (hasdata<Container>::value && isradixsortable<T>) {
+            if (std::size(c) >= DAXE_RADIX_THRESHOLD) {
+                sortrange(std::data(c), std::size(c));
+                std::reverse(std::begin(c), std::end(c));
+                return;
+            }
+        }
+        std::sort(std::rbegin(c), std::rend(c));
+    }
+}
+
+// ==========================================
+// RADIX SORT
+// ==========================================
+
+// radixsort(v) - sorts integer / pair / tuple vectors in place, O(n * bytes)
+template <typename T>
+inline void radixsort(std::vector<T>& v) {
+    static_assert(detail::isradixsortable<T>, "radixsort needs integers, or pairs/tuples of integers");
+    detail::radixsortby(v.data(), v.size(), [](const T& x) -> const T& { return x; });
+}
+
+// ==========================================
+// ARGSORT & SORT BY KEY
+// ==========================================
+namespace detail {
+    // Decorate: (key(v[i]), i) records, keys contiguous with their indices.
+    // Integer keys go through radix passes (stable); otherwise std::sort,
+    // with the index as tie-break when STABLE.
+    template <bool STABLE, typename I, typename T, typename KeyFn>
+    DAXE_NODISCARD inline auto keyedorder(const std::vector<T>& v, KeyFn& key) {
+        using K = std::decay_t<decltype(key(v[0]))>;
+        std::vector<std::pair<K, I>> kv;
+        kv.reserve(v.size());
+        for (size_t i = 0; i < v.size(); ++i) kv.emplace_back(key(v[i]), static_cast<I>(i));
+        if constexpr (isradixsortable<K>) {
+            if (kv.size() >= DAXE_RADIX_THRESHOLD) {
+                radixsortby(kv.data(), kv.size(), [](const std::pair<K, I>& p) -> const K& { return p.first; });
+                return kv;
+            }
+        }
+        if constexpr (STABLE) {
+            std::sort(kv.begin(), kv.end(), [](const std::pair<K, I>& a, const std::pair<K, I>& b) {
+                return a.first < b.first || (!(b.first < a.first) && a.second < b.second);
+            });
+        } else {
+            std::sort(kv.begin(), kv.end(), [](const std::pair<K, I>& a, const std::pair<K, I>& b) { return a.first < b.first; });
+        }
+        return kv;
+    }
+
+    template <bool STABLE, typename I, typename T, typename KeyFn>
+    DAXE_NODISCARD inline std::vector<i64> argsortwith(const std::vector<T>& v, KeyFn& key) {
+        auto kv = keyedorder<STABLE, I>(v, key);
+        std::vector<i64> order(kv.size());
+        for (size_t i = 0; i < kv.size(); ++i) order[i] = static_cast<i64>(kv[i].second);
+        return order;
+    }
+
+    template <bool STABLE, typename I, typename T, typename KeyFn>
+    inline void sortbywith(std::vector<T>& v, KeyFn& key) {
+        auto kv = keyedorder<STABLE, I>(v, key);
+        std::vector<T> out;
+        out.reserve(v.size());
+        for (const auto& p : kv) out.push_back(std::move(v[p.second]));
+        v.swap(out);
+    }
+
+    // u32 indices halve the record size whenever they fit
+    template <bool STABLE, typename T, typename KeyFn>
+    DAXE_NODISCARD inline std::vector<i64> argsortimpl(const std::vector<T>& v, KeyFn& key) {
+        if (v.size() > UINT32_MAX) DAXE_UNLIKELY return argsortwith<STABLE, u64>(v, key);
+        return argsortwith<STABLE, u32>(v, key);
+    }
+
+    template <bool STABLE, typename T, typename KeyFn>
+    inline void sortbyimpl(std::vector<T>& v, KeyFn& key) {
+        if (v.size() > UINT32_MAX) DAXE_UNLIKELY sortbywith<STABLE, u64>(v, key);
+        else sortbywith<STABLE, u32>(v, key);
+    }
+
+    struct Identity {
+        template <typename T>
+        DAXE_NODISCARD constexpr const T& operator()(const T& x) const noexcept { return x; }
+    };
+}
+
+// argsort(v) - indices that put v in ascending order (ties in any order)
+template <typename T>
+DAXE_NODISCARD inline std::vector<i64> argsort(const std::vector<T>& v) {
+    detail::Identity key;
+    return detail::argsortimpl<false>(v, key);
+}
+
+// argsort(v, key) - ascending by key(x); key is called once per element
+template <typename T, typename KeyFn>
+DAXE_NODISCARD inline std::vector<i64> argsort(const std::vector<T>& v, KeyFn key) {
+    return detail::argsortimpl<false>(v, key);
+}
+
+// stableargsort - argsort with equal keys kept in index order
+template <typename T>
+DAXE_NODISCARD inline std::vector<i64> stableargsort(const std::vector<T>& v) {
+    detail::Identity key;
+    return detail::argsortimpl<true>(v, key);
+}
+
+template <typename T, typename KeyFn>
+DAXE_NODISCARD inline std::vector<i64> stableargsort(const std::vector<T>& v, KeyFn key) {
+    return detail::argsortimpl<true>(v, key);
+}
+
+// sortby(v, key) - sorts v in place by key(x), computing each key once
+template <typename T, typename KeyFn>
+inline void sortby(std::vector<T>& v, KeyFn key) {
+    detail::sortbyimpl<false>(v, key);
+}
+
+// stablesortby - sortby with equal keys kept in their original order
+template <typename T, typename KeyFn>
+inline void stablesortby(std::vector<T>& v, KeyFn key) {
+    detail::sortbyimpl<true>(v, key);
+}
+
+// ==========================================
+// COORDINATE COMPRESSION
+// ==========================================
+namespace detail {
+    // (value, position) records sorted by value, then one pass hands out
+    // dense ranks; rank(i) receives each element's rank, uniques the values.
+    // Positions and ranks are u32, so v may hold at most UINT32_MAX elements.
+    template <typename T, typename SetRank>
+    inline std::vector<T> compressinto(const std::vector<T>& v, SetRank&& rank) {
+        if (v.size() > UINT32_MAX) DAXE_UNLIKELY panic("compress: more than UINT32_MAX elements");
+        std::vector<std::pair<T, u32>> kv;
+        kv.reserve(v.size());
+        for (size_t i = 0; i < v.size(); ++i) kv.emplace_back(v[i], static_cast<u32>(i));
+        if constexpr (isradixsortable<T>) {
+            radixsortby(kv.data(), kv.size(), [](const std::pair<T, u32>& p) -> const T& { return p.first; });
+        } else {
+            std::sort(kv.begin(), kv.end(), [](const std::pair<T, u32>& a, const std::pair<T, u32>& b) { return a.first < b.first; });
+        }
+        std::vector<T> uniques;
+        for (size_t i = 0; i < kv.size(); ++i) {
+            if (i == 0 || uniques.back() < kv[i].first) uniques.push_back(kv[i].first);
+            rank(kv[i].second, static_cast<u32>(uniques.size() - 1));
+        }
+        return uniques;
+    }
+}
+
+// compress(v) -> {ranks, sorted unique values}: v[i] == values[ranks[i]].
+// Ranks are dense in [0, values.size()), ready to index a FenwickTree.
+// Panics if v has more than UINT32_MAX elements.
+template <typename T>
+DAXE_NODISCARD inline std::pair<std::vector<u32>, std::vector<T>> compress(const std::vector<T>& v) {
+    std::vector<u32> ranks(v.size());
+    std::vector<T> values = detail::compressinto(v, [&](u32 i, u32 r) { ranks[i] = r; });
+    return {std::move(ranks), std::move(values)};
+}
+
+// compressinplace(v) - replaces every element with its rank, returns the sorted unique values.
+// Panics if a rank does not fit in T (e.g. more than 128 distinct i8 values).
+template <typename T>
+inline std::vector<T> compressinplace(std::vector<T>& v) {
+    static_assert(std::is_integral_v<T> && !std::is_same_v<T, bool>, "compressinplace stores ranks in v, so T must be an integer");
+    return detail::compressinto(v, [&](u32 i, u32 r) {
+        if (static_cast<u64>(r) > static_cast<u64>(std::numeric_limits<T>::max())) DAXE_UNLIKELY panic("compressinplace: too many distinct values for the element type");
+        v[i] = static_cast<T>(r);
+    });
+}
+
+// ==========================================
+// SORTED RANGE ALGEBRA
+// ==========================================
+namespace detail {
+    // Past this size ratio, galloping through the larger range beats a merge
+    inline constexpr size_t GALLOPRATIO = 8;
+
+    template <typename It>
+    inline constexpr bool randomaccess = std::is_base_of_v<std::random_access_iterator_tag, typename std::iterator_traits<It>::iterator_category>;
+
+    // First position in [first, last) not less than x, probing 1, 3, 7, ...
+    // ahead before the binary search: O(log d) for an answer d steps away
+    template <typename It, typename T, typename Less = std::less<>>
+    DAXE_NODISCARD inline It gallop(It first, It last, const T& x, Less less = Less{}) {
+        const auto n = last - first;
+        if (n == 0 || !less(*first, x)) return first;
+        decltype(last - first) lo = 0, hi = 1;   // first[lo] < x
+        while (hi < n && less(first[hi], x)) { lo = hi; hi = 2 * hi + 1; }
+        return std::lower_bound(first + lo + 1, first + std::min(hi, n), x, less);
+    }
+
+    // Elements of a that are also in b; a's copies are written
+    template <typename ItA, typename ItB, typename Out, typename Less = std::less<>>
+    inline Out sortedintersect(ItA a, ItA ae, ItB b, ItB be, Out out, Less less = Less{}) {
+        if constexpr (randomaccess<ItA> && randomaccess<ItB>) {
+            const auto na = static_cast<size_t>(ae - a), nb = static_cast<size_t>(be - b);
+            if (na * GALLOPRATIO < nb) {
+                for (; a != ae && b != be; ++a) {
+                    b = gallop(b, be, *a, less);
+                    if (b != be && !less(*a, *b)) { *out++ = *a; ++b; }
+                }
+                return out;
+            }
+            if (nb * GALLOPRATIO < na) {
+                for (; b != be && a != ae; ++b) {
+                    a = gallop(a, ae, *b, less);
+                    if (a != ae && !less(*b, *a)) { *out++ = *a; ++a; }
+                }
+                return out;
+            }
+        }
+        return std::set_intersection(a, ae, b, be, out, less);
+    }
+
+    // Elements of a not in b
+    template <typename ItA, typename ItB, typename Out, typename Less = std::less<>>
+    inline Out sorteddifference(ItA a, ItA ae, ItB b, ItB be, Out out, Less less = Less{}) {
+        if constexpr (randomaccess<ItA> && randomaccess<ItB>) {
+            const auto na = static_cast<size_t>(ae - a), nb = static_cast<size_t>(be - b);
+            if (na * GALLOPRATIO < nb) {
+                for (; a != ae; ++a) {
+                    b = gallop(b, be, *a, less);
+                    if (b == be || less(*a, *b)) *out++ = *a;
+                }
+                return out;
+            }
+            if (nb * GALLOPRATIO < na) {
+                // Copy a in runs, skipping only the elements equal to some b
+                for (; b != be && a != ae; ++b) {
+                    const ItA stop = gallop(a, ae, *b, less);
+                    out = std::copy(a, stop, out);
+                    a = stop;
+                    if (a != ae && !less(*b, *a)) ++a;
+                }
+                return std::copy(a, ae, out);
+            }
+        }
+        return std::set_difference(a, ae, b, be, out, less);
+    }
+
+    // Is every element of b in a?
+    template <typename ItA, typename ItB, typename Less = std::less<>>
+    DAXE_NODISCARD inline bool sortedincludes(ItA a, ItA ae, ItB b, ItB be, Less less = Less{}) {
+        if constexpr (randomaccess<ItA> && randomaccess<ItB>) {
+            const auto na = static_cast<size_t>(ae - a), nb = static_cast<size_t>(be - b);
+            if (nb > na) return false;
+            if (nb * GALLOPRATIO < na) {
+                for (; b != be; ++b) {
+                    a = gallop(a, ae, *b, less);
+                    if (a == ae || less(*b, *a)) return false;
+                    ++a;
+                }
+                return true;
+            }
+        }
+        return std::includes(a, ae, b, be, less);
+    }
+}
+
+DAXE_NAMESPACE_END
+
+#endif // DAXE_SORT_H
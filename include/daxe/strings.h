@@ -0,0 +1,637 @@
+/*
+ * DAXE - STRING ALGORITHMS
+ * D.A's Axe - Cut through C++ verbosity
+ *
+ * prefixfunction / zfunction / findall - single-pattern matching in O(n + m).
+ * AhoCorasick - many patterns, one pass over the text. Transitions are a
+ * full DFA in one flat array, indexed by node and byte class (only bytes
+ * that occur in some pattern get a class), so each text byte costs one load.
+ * replaceall(s, map) - simultaneous multi-pattern replacement on top of it.
+ * StringHash - polynomial hash mod 2^61 - 1 with O(1) substring hashes.
+ * manacher / Eertree - palindromes in O(n).
+ *
+ * Naming: Flat style (no snake_case)
+ */
+
+#ifndef DAXE_STRINGS_H
+#define DAXE_STRINGS_H
+
+#include "base.h"
+#include "safe.h"
+#include "random.h"
+#include "vectors.h"
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <initializer_list>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+DAXE_NAMESPACE_BEGIN
+
+// ==========================================
+// PREFIX AND Z FUNCTIONS
+// ==========================================
+namespace detail {
+    template <typename T>
+    DAXE_NODISCARD inline vu32 prefixrange(const T* s, size_t n) {
+        vu32 pi(n, 0);
+        for (size_t i = 1; i < n; ++i) {
+            u32 k = pi[i - 1];
+            while (k && !(s[i] == s[k])) k = pi[k - 1];
+            if (s[i] == s[k]) ++k;
+            pi[i] = k;
+        }
+        return pi;
+    }
+
+    template <typename T>
+    DAXE_NODISCARD inline vu32 zrange(const T* s, size_t n) {
+        vu32 z(n, 0);
+        if (n == 0) return z;
+        z[0] = static_cast<u32>(n);
+        for (size_t i = 1, l = 0, r = 0; i < n; ++i) {
+            size_t k = i < r ? std::min<size_t>(r - i, z[i - l]) : 0;
+            while (i + k < n && s[k] == s[i + k]) ++k;
+            z[i] = static_cast<u32>(k);
+            if (i + k > r) { l = i; r = i + k; }
+        }
+        return z;
+    }
+}
+
+// prefixfunction(s)[i] - length of the longest proper border of s[0, i]
+DAXE_NODISCARD inline vu32 prefixfunction(strview s) { return detail::prefixrange(s.data(), s.size()); }
+
+template <typename T>
+DAXE_NODISCARD inline vu32 prefixfunction(const std::vector<T>& v) { return detail::prefixrange(v.data(), v.size()); }
+
+// zfunction(s)[i] - length of the longest common prefix of s and s[i..]; z[0] = |s|
+DAXE_NODISCARD inline vu32 zfunction(strview s) { return detail::zrange(s.data(), s.size()); }
+
+template <typename T>
+DAXE_NODISCARD inline vu32 zfunction(const std::vector<T>& v) { return detail::zrange(v.data(), v.size()); }
+
+// ==========================================
+// SINGLE-PATTERN MATCHING
+// ==========================================
+namespace detail {
+    // f(pos) for each occurrence of p in t, left to right, until f returns
+    // false. Candidates come from memchr on the first byte and are checked
+    // directly; once the checks have cost 2n + m byte compares the rest of t
+    // runs through KMP, so adversarial inputs stay O(n + m).
+    template <typename F>
+    inline void matcheach(strview t, strview p, bool overlap, F&& f) {
+        const size_t n = t.size(), m = p.size();
+        if (m == 0 || m > n) return;
+        size_t budget = 2 * n + m, i = 0;
+        while (i + m <= n) {
+            const void* hit = std::memchr(t.data() + i, p[0], n - m + 1 - i);
+            if (!hit) return;
+            i = static_cast<size_t>(static_cast<const char*>(hit) - t.data());
+            size_t k = 1;
+            while (k < m && t[i + k] == p[k]) ++k;
+            if (k == m) {
+                if (!f(i)) return;
+                i += overlap ? 1 : m;
+            } else {
+                ++i;
+            }
+            if (k >= budget) break;
+            budget -= k;
+        }
+        if (i + m > n) return;
+        const vu32 pi = prefixfunction(p);
+        size_t q = 0;
+        for (size_t j = i; j < n; ++j) {
+            while (q && t[j] != p[q]) q = pi[q - 1];
+            if (t[j] == p[q]) ++q;
+            if (q == m) {
+                if (!f(j + 1 - m)) return;
+                q = overlap ? pi[m - 1] : 0;
+            }
+        }
+    }
+
+    // First occurrence of p in t, or strview::npos (0 for an empty p)
+    DAXE_NODISCARD inline size_t linearfind(strview t, strview p) {
+        if (p.empty()) return 0;
+        size_t at = strview::npos;
+        matcheach(t, p, false, [&](size_t i) { at = i; return false; });
+        return at;
+    }
+}
+
+// findall(text, pattern) -> start of every occurrence, overlaps included
+DAXE_NODISCARD inline vi64 findall(strview text, strview pattern) {
+    vi64 r;
+    detail::matcheach(text, pattern, true, [&](size_t i) { r.push_back(static_cast<i64>(i)); return true; });
+    return r;
+}
+
+// ==========================================
+// AHO-CORASICK
+// ==========================================
+// Pattern ids are positions in the input list. Empty patterns never match;
+// a repeated pattern reports the id of its first copy.
+class AhoCorasick {
+    static constexpr u32 NONE = std::numeric_limits<u32>::max();
+
+    std::array<u16, 256> cls_{};    // byte -> class, 0 for bytes in no pattern
+    u32 width_ = 1;                 // classes + 1
+    std::vector<u32> next_;         // next_[node * width_ + class]
+    std::vector<u32> out_;          // pattern ending exactly here, or NONE
+    std::vector<u32> dict_;         // nearest proper suffix node with a pattern (0 if none)
+    std::vector<u32> lens_;         // pattern lengths
+
+    u32 addnode() {
+        next_.resize(next_.size() + width_, 0);
+        out_.push_back(NONE);
+        return static_cast<u32>(out_.size() - 1);
+    }
+
+    template <typename Container>
+    void build(const Container& patterns) {
+        for (const auto& p : patterns) {
+            for (char c : strview(p)) {
+                u16& k = cls_[static_cast<u8>(c)];
+                if (!k) k = static_cast<u16>(width_++);
+            }
+        }
+        addnode();
+        for (const auto& p : patterns) {
+            const strview s(p);
+            lens_.push_back(static_cast<u32>(s.size()));
+            if (s.empty()) continue;
+            u32 u = 0;
+            for (char c : s) {
+                const size_t e = size_t{u} * width_ + cls_[static_cast<u8>(c)];
+                if (!next_[e]) { const u32 v = addnode(); next_[e] = v; }
+                u = next_[e];
+            }
+            if (out_[u] == NONE) out_[u] = static_cast<u32>(lens_.size() - 1);
+        }
+        // BFS over the trie: missing edges borrow the suffix link's edge, which
+        // turns the trie into a DFA. Node 0 is the root, so 0 also means "no edge".
+        const u32 n = static_cast<u32>(out_.size());
+        std::vector<u32> link(n, 0), queue;
+        dict_.assign(n, 0);
+        queue.reserve(n);
+        for (u32 c = 1; c < width_; ++c) if (next_[c]) queue.push_back(next_[c]);
+        for (size_t h = 0; h < queue.size(); ++h) {
+            const u32 u = queue[h];
+            const u32 f = link[u];
+            dict_[u] = out_[f] != NONE ? f : dict_[f];
+            for (u32 c = 1; c < width_; ++c) {
+                u32& v = next_[size_t{u} * width_ + c];
+                if (v) { link[v] = next_[size_t{f} * width_ + c]; queue.push_back(v); }
+                else v = next_[size_t{f} * width_ + c];
+            }
+        }
+    }
+
+public:
+    AhoCorasick() { addnode(); dict_.push_back(0); }
+
+    // patterns - any container of str / strview / const char*
+    template <typename Container>
+    explicit AhoCorasick(const Container& patterns) { build(patterns); }
+    AhoCorasick(std::initializer_list<strview> patterns) { build(patterns); }
+
+    // Stepping by hand: state 0 is the start, step() follows one byte, and
+    // matchesat(state, f) calls f(id) for every pattern ending at that state
+    DAXE_NODISCARD u32 step(u32 state, char c) const noexcept {
+        return next_[size_t{state} * width_ + cls_[static_cast<u8>(c)]];
+    }
+
+    template <typename F>
+    void matchesat(u32 state, F&& f) const {
+        for (u32 v = out_[state] != NONE ? state : dict_[state]; v; v = dict_[v]) f(out_[v]);
+    }
+
+    // scan(text, f) calls f(end, id) for every occurrence of every pattern,
+    // in order of end; the match is text[end - length(id), end)
+    template <typename F>
+    void scan(strview text, F&& f) const {
+        u32 u = 0;
+        for (size_t i = 0; i < text.size(); ++i) {
+            u = step(u, text[i]);
+            matchesat(u, [&](u32 id) { f(i + 1, id); });
+        }
+    }
+
+    // findall(text) -> (start, id) of every occurrence, in order of end
+    DAXE_NODISCARD std::vector<std::pair<i64, u32>> findall(strview text) const {
+        std::vector<std::pair<i64, u32>> r;
+        scan(text, [&](size_t end, u32 id) { r.emplace_back(static_cast<i64>(end - lens_[id]), id); });
+        return r;
+    }
+
+    // count(text) -> occurrences of all patterns, overlaps included
+    DAXE_NODISCARD i64 count(strview text) const {
+        i64 c = 0;
+        scan(text, [&](size_t, u32) { ++c; });
+        return c;
+    }
+
+    DAXE_NODISCARD size_t size() const noexcept { return lens_.size(); }
+    DAXE_NODISCARD size_t length(u32 id) const noexcept { return lens_[id]; }
+    DAXE_NODISCARD size_t nodes() const noexcept { return out_.size(); }
+};
+
+// ==========================================
+// MULTI-PATTERN REPLACE
+// ==========================================
+// Leftmost-longest and non-overlapping, in one pass: at each position the
+// longest pattern starting there wins and the scan resumes after it. Only
+// the last (longest pattern length) start positions are kept in flight.
+// with[id] replaces pattern id; panics if with has fewer entries than ac.
+DAXE_NODISCARD inline str replaceall(strview s, const AhoCorasick& ac, const std::vector<str>& with) {
+    if (with.size() < ac.size()) DAXE_UNLIKELY panic("replaceall: fewer replacements than patterns");
+    constexpr u32 NONE = std::numeric_limits<u32>::max();
+    size_t longest = 0;
+    for (u32 id = 0; id < ac.size(); ++id) longest = std::max(longest, ac.length(id));
+    if (longest == 0) return str(s);
+
+    size_t ring = 1;
+    while (ring < longest) ring <<= 1;
+    std::vector<u32> best(ring, NONE);   // longest pattern starting at a position
+    str r;
+    r.reserve(s.size());
+    size_t copied = 0;
+
+    auto settle = [&](size_t pos) {
+        u32& b = best[pos & (ring - 1)];
+        if (b != NONE && pos >= copied) {
+            r.append(s.substr(copied, pos - copied));
+            r += with[b];
+            copied = pos + ac.length(b);
+        }
+        b = NONE;
+    };
+
+    u32 u = 0;
+    for (size_t i = 0; i < s.size(); ++i) {
+        u = ac.step(u, s[i]);
+        ac.matchesat(u, [&](u32 id) {
+            u32& b = best[(i + 1 - ac.length(id)) & (ring - 1)];
+            if (b == NONE || ac.length(b) < ac.length(id)) b = id;
+        });
+        // nothing that starts at i + 1 - longest can still end later
+        if (i + 1 >= longest) settle(i + 1 - longest);
+    }
+    for (size_t pos = s.size() >= longest ? s.size() - longest + 1 : 0; pos < s.size(); ++pos) settle(pos);
+    r.append(s.substr(copied));
+    return r;
+}
+
+// replaceall(s, {{"from", "to"}, ...}) - any container of (pattern, replacement) pairs
+template <typename Map>
+DAXE_NODISCARD inline str replaceall(strview s, const Map& replacements) {
+    std::vector<strview> from;
+    std::vector<str> to;
+    for (const auto& [f, t] : replacements) { from.emplace_back(f); to.emplace_back(t); }
+    return replaceall(s, AhoCorasick(from), to);
+}
+
+DAXE_NODISCARD inline str replaceall(strview s, std::initializer_list<std::pair<strview, strview>> replacements) {
+    return replaceall<std::initializer_list<std::pair<strview, strview>>>(s, replacements);
+}
+
+// ==========================================
+// ROLLING HASH
+// ==========================================
+// h(s) = d[0] * B^(n-1) + ... + d[n-1] mod 2^61 - 1, where each element
+// becomes a digit d in [1, 2^61 - 1): zero digits would let "\0a" collide
+// with "a". 64-bit elements do not fit one digit, so they contribute two
+// (high and low halves) and the step per element is B^2. The prime modulus
+// keeps collisions at about n / 2^61 per comparison, and the random base
+// (one per process, from rng()) means no fixed input can be built to collide.
+// Every StringHash shares the base, so hashes of sequences of the same
+// element width compare.
+class StringHash {
+    std::vector<u64> pre_;   // pre_[i] = h(s[0, i))
+    std::vector<u64> pow_;   // pow_[i] = step^i
+    u64 step_ = base();      // B^(digits per element)
+
+    template <typename It>
+    void build(It first, size_t n) {
+        using T = std::decay_t<decltype(*first)>;
+        const u64 b = base();
+        step_ = wide<T> ? mul(b, b) : b;
+        pre_.assign(n + 1, 0);
+        pow_.assign(n + 1, 1);
+        for (size_t i = 0; i < n; ++i, ++first) {
+            if constexpr (wide<T>) {
+                const u64 v = static_cast<u64>(*first);
+                pre_[i + 1] = add(mul(pre_[i], step_), add(mul((v >> 32) + 1, b), (v & 0xFFFFFFFFULL) + 1));
+            } else {
+                pre_[i + 1] = add(mul(pre_[i], b), fold(*first));
+            }
+            pow_[i + 1] = mul(pow_[i], step_);
+        }
+    }
+
+    template <typename T>
+    static constexpr bool wide = sizeof(T) > sizeof(u32);
+
+public:
+    static constexpr u64 MOD = (u64{1} << 61) - 1;
+
+    DAXE_NODISCARD static constexpr u64 add(u64 a, u64 b) noexcept {
+        const u64 r = a + b;
+        return r >= MOD ? r - MOD : r;
+    }
+
+    DAXE_NODISCARD static constexpr u64 sub(u64 a, u64 b) noexcept { return a >= b ? a - b : a + MOD - b; }
+
+    // a * b mod 2^61 - 1 for a, b < 2^61: fold the high bits onto the low ones
+    DAXE_NODISCARD static constexpr u64 mul(u64 a, u64 b) noexcept {
+#if DAXE_HAS_INT128
+        const u128 p = static_cast<u128>(a) * b;
+        return add(static_cast<u64>(p >> 61), static_cast<u64>(p) & MOD);
+#else
+        const u64 ah = a >> 31, al = a & ((u64{1} << 31) - 1);
+        const u64 bh = b >> 31, bl = b & ((u64{1} << 31) - 1);
+        const u64 mid = al * bh + ah * bl;
+        const u64 r = (ah * bh << 1) + (mid >> 30) + ((mid & ((u64{1} << 30) - 1)) << 31) + al * bl;
+        return add(r >> 61, r & MOD);
+#endif
+    }
+
+    // Element of at most 32 bits -> digit in [1, 2^33). Signed values keep
+    // their two's-complement bits.
+    template <typename T>
+    DAXE_NODISCARD static constexpr u64 fold(const T& x) noexcept {
+        static_assert(!wide<T>, "64-bit elements are split into two digits by build()");
+        return static_cast<u64>(static_cast<std::make_unsigned_t<T>>(x)) + 1;
+    }
+
+    DAXE_NODISCARD static u64 base() {
+        static const u64 b = rng().rand<u64>(u64{1} << 40, MOD - 2);
+        return b;
+    }
+
+    StringHash() : pre_(1, 0), pow_(1, 1) {}
+    explicit StringHash(strview s) { build(s.begin(), s.size()); }
+
+    // Any integer sequence, e.g. vi64 or vu32
+    template <typename T, typename = std::enable_if_t<std::is_integral_v<T>>>
+    explicit StringHash(const std::vector<T>& v) { build(v.begin(), v.size()); }
+
+    DAXE_NODISCARD size_t size() const noexcept { return pre_.size() - 1; }
+
+    // substr(l, r) -> hash of [l, r), O(1)
+    DAXE_NODISCARD u64 substr(size_t l, size_t r) const noexcept {
+        return sub(pre_[r], mul(pre_[l], pow_[r - l]));
+    }
+
+    DAXE_NODISCARD u64 hash() const noexcept { return pre_.back(); }
+
+    // step^k (B^k for byte and 32-bit elements), from the table when k <= size()
+    DAXE_NODISCARD u64 power(size_t k) const noexcept {
+        if (k < pow_.size()) return pow_[k];
+        u64 r = 1, b = step_;
+        for (; k; k >>= 1, b = mul(b, b)) if (k & 1) r = mul(r, b);
+        return r;
+    }
+
+    // concat(h(a), h(b), |b|) -> h(a + b)
+    DAXE_NODISCARD u64 concat(u64 ha, u64 hb, size_t lenb) const noexcept { return add(mul(ha, power(lenb)), hb); }
+
+    // Does [l1, l1 + len) equal [l2, l2 + len)?
+    DAXE_NODISCARD bool equal(size_t l1, size_t l2, size_t len) const noexcept {
+        return substr(l1, l1 + len) == substr(l2, l2 + len);
+    }
+
+    // lcp(i, j) -> longest common prefix of the suffixes at i and j, O(log n)
+    DAXE_NODISCARD size_t lcp(size_t i, size_t j) const noexcept { return lcp(i, *this, j); }
+
+    // ... of the suffix at i here and the suffix at j of other
+    DAXE_NODISCARD size_t lcp(size_t i, const StringHash& other, size_t j) const noexcept {
+        size_t lo = 0, hi = std::min(size() - i, other.size() - j);
+        while (lo < hi) {
+            const size_t mid = lo + (hi - lo + 1) / 2;
+            if (substr(i, i + mid) == other.substr(j, j + mid)) lo = mid;
+            else hi = mid - 1;
+        }
+        return lo;
+    }
+};
+
+// ==========================================
+// AUTOMATON TRANSITIONS
+// ==========================================
+namespace detail {
+    // Byte-labelled transitions for automata that grow one state at a time
+    // (SuffixAutomaton, Eertree). A state keeps a short edge list in one
+    // shared pool until its degree passes PROMOTE, then moves to a dense row
+    // over the bytes the input actually uses; its list slots go on a free
+    // list for the next edges. When a row for every state fits DENSEBUDGET,
+    // all states start dense. No per-state allocation either way.
+    // State 0 is never a transition target, so 0 means "none".
+    class ByteEdges {
+        static constexpr u32 ROW = u32{1} << 31;   // head_ tag: the rest is a row index
+        static constexpr u32 PROMOTE = 4;
+        static constexpr size_t DENSEBUDGET = size_t{256} << 20;   // bytes
+
+        std::array<u16, 256> col_{};   // byte -> column + 1, 0 if unused
+        u32 width_ = 0;
+        bool dense_ = false;
+        std::vector<u32> rows_;
+        std::vector<u32> head_;          // ROW | row, or first edge + 1 (0: no edges)
+        std::vector<u32> to_, link_;     // link_: next edge + 1
+        std::vector<u8> byte_;
+        u32 free_ = 0;                   // first reusable edge + 1, chained through link_
+
+        DAXE_NODISCARD u32* row(u32 h) noexcept { return rows_.data() + size_t{h - ROW} * width_; }
+        DAXE_NODISCARD const u32* row(u32 h) const noexcept { return rows_.data() + size_t{h - ROW} * width_; }
+
+        u32 addrow() {
+            const u32 r = static_cast<u32>(rows_.size() / width_);
+            rows_.resize(rows_.size() + width_, 0);
+            return ROW | r;
+        }
+
+        void addedge(u32 v, u8 b, u32 to) {
+            if (free_) {
+                const u32 e = free_;
+                free_ = link_[e - 1];
+                to_[e - 1] = to;
+                byte_[e - 1] = b;
+                link_[e - 1] = head_[v];
+                head_[v] = e;
+                return;
+            }
+            to_.push_back(to);
+            byte_.push_back(b);
+            link_.push_back(head_[v]);
+            head_[v] = static_cast<u32>(to_.size());
+        }
+
+    public:
+        // text - the input (for its alphabet); states - upper bound on states
+        void init(strview text, size_t states) {
+            for (char c : text) {
+                u16& col = col_[static_cast<u8>(c)];
+                if (!col) col = static_cast<u16>(++width_);
+            }
+            dense_ = width_ > 0 && states * width_ * sizeof(u32) <= DENSEBUDGET;
+            head_.reserve(states);
+            if (dense_) {
+                rows_.reserve(states * width_);
+            } else {
+                // A suffix automaton has at most 3n transitions, an eertree n;
+                // reserving up front avoids the doubling copy at the peak
+                const size_t edges = 3 * text.size();
+                to_.reserve(edges); link_.reserve(edges); byte_.reserve(edges);
+            }
+        }
+
+        void addstate() { head_.push_back(dense_ ? addrow() : 0); }
+
+        DAXE_NODISCARD u32 get(u32 v, char c) const noexcept {
+            const u32 h = head_[v];
+            if (h >= ROW) {
+                const u16 col = col_[static_cast<u8>(c)];
+                return col ? row(h)[col - 1] : 0;
+            }
+            for (u32 e = h; e; e = link_[e - 1]) if (byte_[e - 1] == static_cast<u8>(c)) return to_[e - 1];
+            return 0;
+        }
+
+        void set(u32 v, char c, u32 to) {
+            const u8 b = static_cast<u8>(c);
+            if (head_[v] < ROW) {
+                u32 degree = 0;
+                for (u32 e = head_[v]; e; e = link_[e - 1], ++degree) if (byte_[e - 1] == b) { to_[e - 1] = to; return; }
+                if (degree < PROMOTE) { addedge(v, b, to); return; }
+                // Copy the list into a row and hand its slots to the free list
+                const u32 h = addrow();
+                u32 e = head_[v];
+                for (;; e = link_[e - 1]) {
+                    row(h)[col_[byte_[e - 1]] - 1] = to_[e - 1];
+                    if (!link_[e - 1]) break;
+                }
+                link_[e - 1] = free_;
+                free_ = head_[v];
+                head_[v] = h;
+            }
+            row(head_[v])[col_[b] - 1] = to;
+        }
+
+        // Give the fresh state dst the same transitions as src
+        void copy(u32 src, u32 dst) {
+            if (head_[src] >= ROW) {
+                if (head_[dst] < ROW) head_[dst] = addrow();
+                std::copy_n(row(head_[src]), width_, row(head_[dst]));
+                return;
+            }
+            for (u32 e = head_[src]; e; e = link_[e - 1]) addedge(dst, byte_[e - 1], to_[e - 1]);
+        }
+    };
+}
+
+// ==========================================
+// PALINDROMES
+// ==========================================
+// manacher(s)[k], k in [0, 2n - 1) - length of the longest palindrome centred
+// on s[k / 2] (even k) or between s[k / 2] and s[k / 2 + 1] (odd k)
+DAXE_NODISCARD inline vu32 manacher(strview s) {
+    const size_t n = s.size();
+    if (n == 0) return {};
+    vu32 odd(n), even(n);   // odd[i]: radius incl. centre; even[i]: radius left of gap before i
+    for (size_t i = 0, l = 0, r = 0; i < n; ++i) {
+        size_t k = i < r ? std::min<size_t>(odd[l + r - 1 - i], r - i) : 1;
+        while (i >= k && i + k < n && s[i - k] == s[i + k]) ++k;
+        odd[i] = static_cast<u32>(k);
+        if (i + k > r) { l = i + 1 - k; r = i + k; }
+    }
+    for (size_t i = 0, l = 0, r = 0; i < n; ++i) {
+        size_t k = i < r ? std::min<size_t>(even[l + r - i], r - i) : 0;
+        while (i >= k + 1 && i + k < n && s[i - k - 1] == s[i + k]) ++k;
+        even[i] = static_cast<u32>(k);
+        if (i + k > r) { l = i - k; r = i + k; }
+    }
+    vu32 out(2 * n - 1);
+    for (size_t i = 0; i < n; ++i) out[2 * i] = 2 * odd[i] - 1;
+    for (size_t i = 1; i < n; ++i) out[2 * i - 1] = 2 * even[i];
+    return out;
+}
+
+// longestpalindrome(s) -> {start, length} of the leftmost longest palindromic substring
+DAXE_NODISCARD inline std::pair<i64, i64> longestpalindrome(strview s) {
+    const vu32 m = manacher(s);
+    i64 start = 0, len = 0;
+    for (size_t k = 0; k < m.size(); ++k) {
+        const i64 l = static_cast<i64>(m[k]);
+        const i64 st = static_cast<i64>(k + 1) / 2 - l / 2;
+        if (l > len || (l == len && st < start)) { len = l; start = st; }
+    }
+    return {start, len};
+}
+
+// Eertree (palindromic tree): one node per distinct palindrome of s. Node 0
+// is the length -1 root, node 1 the empty palindrome; link(v) is the longest
+// proper palindromic suffix of v.
+class Eertree {
+    detail::ByteEdges next_;
+    std::vector<i32> len_;
+    vu32 link_, depth_;   // depth_[v] - palindromic suffixes of v, v included
+    i64 total_ = 0;
+
+    u32 addnode(i32 len, u32 link) {
+        next_.addstate();
+        len_.push_back(len);
+        link_.push_back(link);
+        depth_.push_back(0);
+        return static_cast<u32>(len_.size() - 1);
+    }
+
+public:
+    explicit Eertree(strview s) {
+        next_.init(s, s.size() + 2);
+        len_.reserve(s.size() + 2); link_.reserve(s.size() + 2); depth_.reserve(s.size() + 2);
+        addnode(-1, 0);
+        addnode(0, 0);
+        // Longest suffix palindrome v of s[0, i) that s[i] extends: s[i - len(v) - 1] == s[i]
+        auto extendable = [&](u32 v, size_t i) {
+            while (true) {
+                const i64 j = static_cast<i64>(i) - len_[v] - 1;
+                if (j >= 0 && s[static_cast<size_t>(j)] == s[i]) return v;
+                v = link_[v];
+            }
+        };
+        u32 last = 1;
+        for (size_t i = 0; i < s.size(); ++i) {
+            const u32 cur = extendable(last, i);
+            u32 v = next_.get(cur, s[i]);
+            if (!v) {
+                const u32 link = len_[cur] == -1 ? 1 : next_.get(extendable(link_[cur], i), s[i]);
+                v = addnode(len_[cur] + 2, link);
+                depth_[v] = depth_[link] + 1;
+                next_.set(cur, s[i], v);
+            }
+            last = v;
+            total_ += depth_[v];
+        }
+    }
+
+    DAXE_NODISCARD i64 size() const noexcept { return static_cast<i64>(len_.size()); }
+    DAXE_NODISCARD i64 length(u32 v) const noexcept { return len_[v]; }
+    DAXE_NODISCARD u32 link(u32 v) const noexcept { return link_[v]; }
+
+    // Distinct non-empty palindromic substrings
+    DAXE_NODISCARD i64 distinctpalindromes() const noexcept { return size() - 2; }
+
+    // Palindromic substrings counted with multiplicity (by position)
+    DAXE_NODISCARD i64 totalpalindromes() const noexcept { return total_; }
+};
+
+DAXE_NAMESPACE_END
+
+#endif // DAXE_STRINGS_H
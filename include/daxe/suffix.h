@@ -0,0 +1,320 @@
+/*
+ * DAXE - SUFFIX ARRAYS
+ * D.A's Axe - Cut through C++ verbosity
+ *
+ * suffixarray(s) - SA-IS, O(n) for strings and for integer sequences
+ * (integers are rank-compressed first).
+ * lcparray(s, sa) - Kasai, O(n).
+ * SuffixArray - both, plus O(1) LCP of any two suffixes via RangeMin.
+ * SuffixAutomaton - minimal automaton of all substrings, O(n) states.
+ *
+ * Naming: Flat style (no snake_case)
+ */
+
+#ifndef DAXE_SUFFIX_H
+#define DAXE_SUFFIX_H
+
+#include "base.h"
+#include "vectors.h"
+#include "sort.h"
+#include "graph.h"
+#include "strings.h"
+#include <algorithm>
+#include <limits>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+DAXE_NAMESPACE_BEGIN
+
+namespace detail {
+    // ==========================================
+    // SA-IS
+    // ==========================================
+    // s[i] in [0, upper]. Suffixes are typed S (smaller than the next suffix)
+    // or L; LMS positions (S after L) are placed at their bucket ends, the L
+    // and S types are induced from them, the LMS substrings are named, and
+    // if names repeat, the reduced string is sorted recursively.
+    inline vu32 sais(const vu32& s, u32 upper) {
+        constexpr u32 NONE = std::numeric_limits<u32>::max();
+        const size_t n = s.size();
+        if (n == 0) return {};
+        if (n == 1) return {0};
+        if (n < 16) {
+            vu32 sa(n);
+            for (size_t i = 0; i < n; ++i) sa[i] = static_cast<u32>(i);
+            std::sort(sa.begin(), sa.end(), [&](u32 a, u32 b) {
+                return std::lexicographical_compare(s.begin() + a, s.end(), s.begin() + b, s.end());
+            });
+            return sa;
+        }
+
+        std::vector<bool> stype(n, false);
+        for (size_t i = n - 1; i-- > 0;) stype[i] = s[i] == s[i + 1] ? stype[i + 1] : s[i] < s[i + 1];
+
+        // bucket c spans [lstart[c], lstart[c + 1]); its S part starts at sstart[c]
+        vu32 lstart(upper + 2, 0), sstart(upper + 1, 0);
+        for (size_t i = 0; i < n; ++i) {
+            if (stype[i]) ++lstart[s[i] + 1];
+            else ++sstart[s[i]];
+        }
+        for (u32 c = 0; c <= upper; ++c) {
+            sstart[c] += lstart[c];
+            lstart[c + 1] += sstart[c];
+        }
+
+        vu32 sa(n);
+        vu32 head(upper + 2);
+        auto induce = [&](const vu32& lms) {
+            std::fill(sa.begin(), sa.end(), NONE);
+            std::copy(sstart.begin(), sstart.end(), head.begin());
+            for (u32 d : lms) sa[head[s[d]]++] = d;
+            std::copy(lstart.begin(), lstart.end(), head.begin());
+            sa[head[s[n - 1]]++] = static_cast<u32>(n - 1);
+            for (size_t i = 0; i < n; ++i) {
+                const u32 v = sa[i];
+                if (v != NONE && v >= 1 && !stype[v - 1]) sa[head[s[v - 1]]++] = v - 1;
+            }
+            std::copy(lstart.begin(), lstart.end(), head.begin());
+            for (size_t i = n; i-- > 0;) {
+                const u32 v = sa[i];
+                if (v != NONE && v >= 1 && stype[v - 1]) sa[--head[s[v - 1] + 1]] = v - 1;
+            }
+        };
+
+        vu32 lmsindex(n + 1, NONE), lms;
+        for (size_t i = 1; i < n; ++i) {
+            if (!stype[i - 1] && stype[i]) {
+                lmsindex[i] = static_cast<u32>(lms.size());
+                lms.push_back(static_cast<u32>(i));
+            }
+        }
+        const size_t m = lms.size();
+        induce(lms);
+        if (m == 0) return sa;
+
+        vu32 sortedlms;
+        sortedlms.reserve(m);
+        for (u32 v : sa) if (lmsindex[v] != NONE) sortedlms.push_back(v);
+
+        // Name the LMS substrings in sorted order; equal substrings share a name
+        vu32 reduced(m);
+        u32 names = 0;
+        reduced[lmsindex[sortedlms[0]]] = 0;
+        for (size_t i = 1; i < m; ++i) {
+            size_t l = sortedlms[i - 1], r = sortedlms[i];
+            const size_t endl = lmsindex[l] + 1 < m ? lms[lmsindex[l] + 1] : n;
+            const size_t endr = lmsindex[r] + 1 < m ? lms[lmsindex[r] + 1] : n;
+            bool same = endl - l == endr - r;
+            if (same) {
+                while (l < endl && s[l] == s[r]) { ++l; ++r; }
+                same = l != n && s[l] == s[r];
+            }
+            if (!same) ++names;
+            reduced[lmsindex[sortedlms[i]]] = names;
+        }
+        const vu32 reducedsa = sais(reduced, names);
+        for (size_t i = 0; i < m; ++i) sortedlms[i] = lms[reducedsa[i]];
+        induce(sortedlms);
+        return sa;
+    }
+
+    template <typename T>
+    DAXE_NODISCARD inline vu32 lcprange(const T* s, size_t n, const vu32& sa) {
+        if (n == 0) return {};
+        vu32 rank(n), lcp(n - 1);
+        for (size_t i = 0; i < n; ++i) rank[sa[i]] = static_cast<u32>(i);
+        size_t h = 0;
+        for (size_t i = 0; i < n; ++i) {
+            if (h) --h;
+            if (rank[i] == 0) continue;
+            const size_t j = sa[rank[i] - 1];
+            while (i + h < n && j + h < n && s[i + h] == s[j + h]) ++h;
+            lcp[rank[i] - 1] = static_cast<u32>(h);
+        }
+        return lcp;
+    }
+}
+
+// ==========================================
+// SUFFIX ARRAY / LCP ARRAY
+// ==========================================
+// suffixarray(s)[k] - start of the k-th smallest suffix
+DAXE_NODISCARD inline vu32 suffixarray(strview s) {
+    vu32 codes(s.size());
+    for (size_t i = 0; i < s.size(); ++i) codes[i] = static_cast<u8>(s[i]);
+    return detail::sais(codes, 255);
+}
+
+template <typename T>
+DAXE_NODISCARD inline vu32 suffixarray(const std::vector<T>& v) {
+    static_assert(std::is_integral_v<T>, "suffixarray needs characters or integers");
+    auto [ranks, values] = compress(v);
+    return detail::sais(ranks, values.empty() ? 0 : static_cast<u32>(values.size() - 1));
+}
+
+// lcparray(s, sa)[k] - longest common prefix of suffixes sa[k] and sa[k + 1]
+DAXE_NODISCARD inline vu32 lcparray(strview s, const vu32& sa) { return detail::lcprange(s.data(), s.size(), sa); }
+
+template <typename T>
+DAXE_NODISCARD inline vu32 lcparray(const std::vector<T>& v, const vu32& sa) { return detail::lcprange(v.data(), v.size(), sa); }
+
+// ==========================================
+// SUFFIX ARRAY CLASS
+// ==========================================
+class SuffixArray {
+    vu32 sa_, rank_, lcp_;
+    RangeMin<u32> rmq_;
+
+    void finish() {
+        rank_.resize(sa_.size());
+        for (size_t i = 0; i < sa_.size(); ++i) rank_[sa_[i]] = static_cast<u32>(i);
+        if (!lcp_.empty()) rmq_ = RangeMin<u32>(lcp_);
+    }
+
+public:
+    SuffixArray() = default;
+    explicit SuffixArray(strview s) : sa_(suffixarray(s)), lcp_(lcparray(s, sa_)) { finish(); }
+
+    template <typename T>
+    explicit SuffixArray(const std::vector<T>& v) : sa_(suffixarray(v)), lcp_(lcparray(v, sa_)) { finish(); }
+
+    DAXE_NODISCARD i64 size() const noexcept { return static_cast<i64>(sa_.size()); }
+    DAXE_NODISCARD const vu32& sa() const noexcept { return sa_; }
+    DAXE_NODISCARD const vu32& rank() const noexcept { return rank_; }
+    DAXE_NODISCARD const vu32& lcp() const noexcept { return lcp_; }
+
+    // lcp(i, j) -> longest common prefix of the suffixes starting at i and j, O(1)
+    DAXE_NODISCARD i64 lcp(i64 i, i64 j) const {
+        if (i == j) return size() - i;
+        u32 a = rank_[static_cast<size_t>(i)], b = rank_[static_cast<size_t>(j)];
+        if (a > b) std::swap(a, b);
+        return rmq_.query(a, b - 1);
+    }
+
+    // Number of distinct non-empty substrings: n(n+1)/2 minus the shared prefixes
+    DAXE_NODISCARD i64 distinctsubstrings() const {
+        const i64 n = size();
+        i64 shared = 0;
+        for (u32 h : lcp_) shared += h;
+        return n * (n + 1) / 2 - shared;
+    }
+
+    // longestrepeat() -> {start, length} of a longest substring occurring at
+    // least twice (occurrences may overlap); length 0 if there is none
+    DAXE_NODISCARD std::pair<i64, i64> longestrepeat() const {
+        if (lcp_.empty()) return {0, 0};
+        const size_t k = static_cast<size_t>(std::max_element(lcp_.begin(), lcp_.end()) - lcp_.begin());
+        if (lcp_[k] == 0) return {0, 0};
+        return {static_cast<i64>(sa_[k]), static_cast<i64>(lcp_[k])};
+    }
+};
+
+// ==========================================
+// SUFFIX AUTOMATON
+// ==========================================
+// At most 2n states; each state is a class of substrings with the same end
+// positions, the longest of length len(v). Transitions use detail::ByteEdges,
+// so a 10^7-character text needs a few hundred MB rather than one map per state.
+class SuffixAutomaton {
+    static constexpr u32 NONE = std::numeric_limits<u32>::max();
+
+    detail::ByteEdges next_;
+    vu32 len_, link_;
+    vu32 count_;   // end positions; 1 per prefix state until the constructor propagates them
+
+    u32 addstate(u32 len, u32 link, bool clone) {
+        next_.addstate();
+        len_.push_back(len);
+        link_.push_back(link);
+        count_.push_back(clone ? 0 : 1);
+        return static_cast<u32>(len_.size() - 1);
+    }
+
+    // Walk t from the root; 0 if t is not a substring (the root itself for t == "")
+    DAXE_NODISCARD u32 walk(strview t, bool& found) const noexcept {
+        u32 v = 0;
+        found = true;
+        for (char c : t) {
+            v = next_.get(v, c);
+            if (!v) { found = false; return 0; }
+        }
+        return v;
+    }
+
+public:
+    explicit SuffixAutomaton(strview s) {
+        const size_t states = std::max<size_t>(2 * s.size(), 1);
+        next_.init(s, states);
+        len_.reserve(states); link_.reserve(states); count_.reserve(states);
+        addstate(0, NONE, false);
+        u32 last = 0;
+        for (char c : s) {
+            const u32 cur = addstate(len_[last] + 1, 0, false);
+            u32 p = last;
+            while (p != NONE && !next_.get(p, c)) { next_.set(p, c, cur); p = link_[p]; }
+            if (p != NONE) {
+                const u32 q = next_.get(p, c);
+                if (len_[p] + 1 == len_[q]) {
+                    link_[cur] = q;
+                } else {
+                    const u32 cl = addstate(len_[p] + 1, link_[q], true);
+                    next_.copy(q, cl);
+                    while (p != NONE && next_.get(p, c) == q) { next_.set(p, c, cl); p = link_[p]; }
+                    link_[q] = link_[cur] = cl;
+                }
+            }
+            last = cur;
+        }
+
+        // Counts flow up the suffix links in decreasing len order (counting sort by len)
+        const size_t n = len_.size();
+        vu32 bucket(s.size() + 2, 0), order(n);
+        for (u32 l : len_) ++bucket[l + 1];
+        for (size_t i = 1; i < bucket.size(); ++i) bucket[i] += bucket[i - 1];
+        for (size_t v = 0; v < n; ++v) order[bucket[len_[v]]++] = static_cast<u32>(v);
+        for (size_t i = n; i-- > 1;) count_[link_[order[i]]] += count_[order[i]];
+    }
+
+    DAXE_NODISCARD i64 size() const noexcept { return static_cast<i64>(len_.size()); }
+    DAXE_NODISCARD i64 length(u32 v) const noexcept { return len_[v]; }
+    DAXE_NODISCARD u32 link(u32 v) const noexcept { return link_[v]; }
+    DAXE_NODISCARD u32 next(u32 v, char c) const noexcept { return next_.get(v, c); }
+
+    DAXE_NODISCARD bool has(strview t) const noexcept {
+        bool found;
+        (void)walk(t, found);
+        return found;
+    }
+
+    // Occurrences of t in s (overlapping), O(|t|); 0 for an empty t, like findall
+    DAXE_NODISCARD i64 occurrences(strview t) const noexcept {
+        bool found;
+        const u32 v = walk(t, found);
+        return found && !t.empty() ? count_[v] : 0;
+    }
+
+    // Number of distinct non-empty substrings
+    DAXE_NODISCARD i64 distinctsubstrings() const noexcept {
+        i64 total = 0;
+        for (size_t v = 1; v < len_.size(); ++v) total += len_[v] - len_[link_[v]];
+        return total;
+    }
+
+    // longestcommon(t) -> {start in t, length} of a longest substring of both s and t
+    DAXE_NODISCARD std::pair<i64, i64> longestcommon(strview t) const noexcept {
+        u32 v = 0, l = 0;
+        i64 best = 0, end = 0;
+        for (size_t i = 0; i < t.size(); ++i) {
+            while (v && !next_.get(v, t[i])) { v = link_[v]; l = len_[v]; }
+            if (const u32 w = next_.get(v, t[i])) { v = w; ++l; }
+            if (l > best) { best = l; end = static_cast<i64>(i) + 1; }
+        }
+        return {end - best, best};
+    }
+};
+
+DAXE_NAMESPACE_END
+
+#endif // DAXE_SUFFIX_H
@@ -0,0 +1,299 @@
+/*
+ * DAXE - TRIES
+ * D.A's Axe - Cut through C++ verbosity
+ *
+ * Trie<SIGMA, FIRST> - words over the characters [FIRST, FIRST + SIGMA),
+ * 'a'..'z' by default. Child arrays of all nodes live in one vector.
+ * BinaryTrie<BITS> - multiset of BITS-bit integers for xor-min/max,
+ * k-th smallest and rank queries, nodes in one vector.
+ *
+ * Naming: Flat style (no snake_case)
+ */
+
+#ifndef DAXE_TRIE_H
+#define DAXE_TRIE_H
+
+#include "base.h"
+#include "safe.h"
+#include <array>
+#include <string>
+#include <string_view>
+#include <vector>
+
+DAXE_NAMESPACE_BEGIN
+
+// ==========================================
+// TRIE
+// ==========================================
+// Node v owns children_[v * SIGMA, (v + 1) * SIGMA); 0 means no child since
+// the root is node 0. Removing words only drops counts, nodes are kept.
+template <u32 SIGMA = 26, char FIRST = 'a'>
+class Trie {
+    static_assert(SIGMA > 0 && SIGMA <= 256, "Trie alphabet must fit in a byte");
+
+    std::vector<u32> children_;
+    std::vector<u32> ends_;     // words ending at the node
+    std::vector<u32> passes_;   // words through the node, itself included
+    i64 size_ = 0;
+
+    DAXE_NODISCARD static u32 column(char c) noexcept {
+        return static_cast<u32>(static_cast<u8>(c) - static_cast<u8>(FIRST)) & 0xFF;
+    }
+
+    u32 addnode() {
+        children_.resize(children_.size() + SIGMA, 0);
+        ends_.push_back(0);
+        passes_.push_back(0);
+        return static_cast<u32>(ends_.size() - 1);
+    }
+
+    // Node spelling p, or 0 with found == false
+    DAXE_NODISCARD u32 walk(strview p, bool& found) const noexcept {
+        u32 v = 0;
+        found = false;
+        for (char c : p) {
+            const u32 k = column(c);
+            if (k >= SIGMA) DAXE_UNLIKELY return 0;
+            v = children_[size_t{v} * SIGMA + k];
+            if (!v) return 0;
+        }
+        found = true;
+        return v;
+    }
+
+    void collect(u32 v, str& word, std::vector<str>& out) const {
+        if (ends_[v]) out.push_back(word);
+        for (u32 k = 0; k < SIGMA; ++k) {
+            const u32 w = children_[size_t{v} * SIGMA + k];
+            if (!w || !passes_[w]) continue;
+            word.push_back(static_cast<char>(static_cast<u8>(FIRST) + k));
+            collect(w, word, out);
+            word.pop_back();
+        }
+    }
+
+public:
+    Trie() { addnode(); }
+
+    // nodes - expected number of nodes (at most the total length of the words + 1)
+    void reserve(size_t nodes) {
+        children_.reserve(nodes * SIGMA);
+        ends_.reserve(nodes);
+        passes_.reserve(nodes);
+    }
+
+    void add(strview w, u32 times = 1) {
+        u32 v = 0;
+        passes_[0] += times;
+        for (char c : w) {
+            const u32 k = column(c);
+            if (k >= SIGMA) DAXE_UNLIKELY panic("Trie: character outside the alphabet");
+            u32 child = children_[size_t{v} * SIGMA + k];
+            if (!child) {
+                child = addnode();   // may reallocate children_, so index again below
+                children_[size_t{v} * SIGMA + k] = child;
+            }
+            v = child;
+            passes_[v] += times;
+        }
+        ends_[v] += times;
+        size_ += times;
+    }
+
+    // Removes one copy of w; false if w is not present
+    bool remove(strview w) {
+        if (!has(w)) return false;
+        u32 v = 0;
+        --passes_[0];
+        for (char c : w) {
+            v = children_[size_t{v} * SIGMA + column(c)];
+            --passes_[v];
+        }
+        --ends_[v];
+        --size_;
+        return true;
+    }
+
+    DAXE_NODISCARD i64 count(strview w) const noexcept {
+        bool found;
+        const u32 v = walk(w, found);
+        return found ? ends_[v] : 0;
+    }
+    DAXE_NODISCARD bool has(strview w) const noexcept { return count(w) > 0; }
+
+    // Words (with multiplicity) that start with p
+    DAXE_NODISCARD i64 countprefix(strview p) const noexcept {
+        bool found;
+        const u32 v = walk(p, found);
+        return found ? passes_[v] : 0;
+    }
+    DAXE_NODISCARD bool hasprefix(strview p) const noexcept { return countprefix(p) > 0; }
+
+    // Length of the longest word that is a prefix of text, -1 if none
+    DAXE_NODISCARD i64 longestprefix(strview text) const noexcept {
+        i64 best = ends_[0] ? 0 : -1;
+        u32 v = 0;
+        for (size_t i = 0; i < text.size(); ++i) {
+            const u32 k = column(text[i]);
+            if (k >= SIGMA) break;
+            v = children_[size_t{v} * SIGMA + k];
+            if (!v || !passes_[v]) break;
+            if (ends_[v]) best = static_cast<i64>(i) + 1;
+        }
+        return best;
+    }
+
+    // Distinct words starting with p, in lexicographic order
+    DAXE_NODISCARD std::vector<str> withprefix(strview p) const {
+        std::vector<str> out;
+        bool found;
+        const u32 v = walk(p, found);
+        if (!found || !passes_[v]) return out;
+        str word(p);
+        collect(v, word, out);
+        return out;
+    }
+
+    DAXE_NODISCARD i64 size() const noexcept { return size_; }
+    DAXE_NODISCARD bool empty() const noexcept { return size_ == 0; }
+    DAXE_NODISCARD i64 nodes() const noexcept { return static_cast<i64>(ends_.size()); }
+};
+
+// ==========================================
+// BINARY TRIE
+// ==========================================
+// Multiset of integers in [0, 2^BITS), most significant bit first. Every
+// query walks BITS levels.
+template <u32 BITS = 64>
+class BinaryTrie {
+    static_assert(BITS > 0 && BITS <= 64, "BinaryTrie holds up to 64-bit keys");
+
+    std::vector<std::array<u32, 2>> children_;
+    std::vector<u32> counts_;   // keys in the subtree
+
+    u32 addnode() {
+        children_.push_back({0, 0});
+        counts_.push_back(0);
+        return static_cast<u32>(counts_.size() - 1);
+    }
+
+    DAXE_NODISCARD static u32 digit(u64 x, u32 level) noexcept { return static_cast<u32>(x >> level) & 1; }
+
+    void requirenonempty(const char* what) const {
+        if (counts_[0] == 0) DAXE_UNLIKELY panic(what);
+    }
+
+    // Leaf holding x, or 0 if x is absent
+    DAXE_NODISCARD u32 leaf(u64 x) const noexcept {
+        if constexpr (BITS < 64) {
+            if (x >> BITS) return 0;
+        }
+        u32 v = 0;
+        for (u32 level = BITS; level-- > 0;) {
+            v = children_[v][digit(x, level)];
+            if (!v || !counts_[v]) return 0;
+        }
+        return v;
+    }
+
+public:
+    BinaryTrie() { addnode(); }
+
+    // keys - expected number of distinct keys
+    void reserve(size_t keys) {
+        children_.reserve(keys * BITS + 1);
+        counts_.reserve(keys * BITS + 1);
+    }
+
+    void add(u64 x, u32 times = 1) {
+        if constexpr (BITS < 64) {
+            if (x >> BITS) DAXE_UNLIKELY panic("BinaryTrie: key wider than BITS");
+        }
+        u32 v = 0;
+        counts_[0] += times;
+        for (u32 level = BITS; level-- > 0;) {
+            u32 w = children_[v][digit(x, level)];
+            if (!w) {
+                w = addnode();
+                children_[v][digit(x, level)] = w;
+            }
+            v = w;
+            counts_[v] += times;
+        }
+    }
+
+    // Removes one copy of x; false if x is not present
+    bool remove(u64 x) {
+        if (!leaf(x)) return false;
+        u32 v = 0;
+        --counts_[0];
+        for (u32 level = BITS; level-- > 0;) {
+            v = children_[v][digit(x, level)];
+            --counts_[v];
+        }
+        return true;
+    }
+
+    DAXE_NODISCARD i64 count(u64 x) const noexcept {
+        const u32 v = leaf(x);
+        return v ? counts_[v] : 0;
+    }
+    DAXE_NODISCARD bool has(u64 x) const noexcept { return leaf(x) != 0; }
+
+    // Keys strictly less than x
+    DAXE_NODISCARD i64 countless(u64 x) const noexcept {
+        if constexpr (BITS < 64) {
+            if (x >> BITS) return counts_[0];
+        }
+        i64 r = 0;
+        u32 v = 0;
+        for (u32 level = BITS; level-- > 0;) {
+            const u32 d = digit(x, level);
+            if (d && children_[v][0]) r += counts_[children_[v][0]];
+            v = children_[v][d];
+            if (!v) break;
+        }
+        return r;
+    }
+
+    // k-th smallest key (0-based) of {y ^ mask}; panics if k >= size()
+    DAXE_NODISCARD u64 kth(i64 k, u64 mask = 0) const {
+        if (k < 0 || k >= size()) DAXE_UNLIKELY panic("BinaryTrie: kth out of range");
+        u64 r = 0;
+        u32 v = 0;
+        for (u32 level = BITS; level-- > 0;) {
+            const u32 low = digit(mask, level);
+            const u32 w = children_[v][low];
+            const i64 c = w ? counts_[w] : 0;
+            if (k < c) {
+                v = w;
+            } else {
+                k -= c;
+                v = children_[v][low ^ 1];
+                r |= u64{1} << level;
+            }
+        }
+        return r;
+    }
+
+    // min / max over stored y of x ^ y; panics when empty
+    DAXE_NODISCARD u64 xormin(u64 x) const {
+        requirenonempty("BinaryTrie: xormin on empty trie");
+        return kth(0, x);
+    }
+    DAXE_NODISCARD u64 xormax(u64 x) const {
+        requirenonempty("BinaryTrie: xormax on empty trie");
+        return kth(size() - 1, x);
+    }
+
+    DAXE_NODISCARD u64 min() const { requirenonempty("BinaryTrie: min on empty trie"); return kth(0); }
+    DAXE_NODISCARD u64 max() const { requirenonempty("BinaryTrie: max on empty trie"); return kth(size() - 1); }
+
+    DAXE_NODISCARD i64 size() const noexcept { return counts_[0]; }
+    DAXE_NODISCARD bool empty() const noexcept { return counts_[0] == 0; }
+    DAXE_NODISCARD i64 nodes() const noexcept { return static_cast<i64>(counts_.size()); }
+};
+
+DAXE_NAMESPACE_END
+
+#endif // DAXE_TRIE_H
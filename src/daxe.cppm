@@ -53,11 +53,21 @@ module;
 #include <variant>
 
 // Threading & Time
+#include <atomic>
 #include <chrono>
+#include <condition_variable>
+#include <exception>
 #include <mutex>
 #include <random>
 #include <thread>
 
+// SIMD intrinsics (daxe/simd.h)
+#if (defined(__x86_64__) || defined(_M_X64)) && !defined(DAXE_NO_SIMD)
+#include <immintrin.h>
+#elif (defined(__aarch64__) || defined(_M_ARM64)) && !defined(DAXE_NO_SIMD)
+#include <arm_neon.h>
+#endif
+
 // C++23 Features (Feature detection)
 // This fixes the specific error with std::print
 #if defined(__has_include)
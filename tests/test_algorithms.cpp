@@ -0,0 +1,448 @@
+#include <daxe.h>
+#include <cassert>
+
+using namespace dax;
+
+fx testparallel() {
+    vi64 v(300000);
+    for (size_t i = 0; i < v.size(); ++i) v[i] = static_cast<i64>((i * 7919) % 100003) - 50000;
+
+    assert(sum(par, v) == sum(v));
+    assert(count(par, v, v[12345]) == count(v, v[12345]));
+    assert(any(par, v, [](i64 x) { return x == 49999; }) == any(v, [](i64 x) { return x == 49999; }));
+    assert(all(par, v, [](i64 x) { return x >= -50000; }));
+    assert(none(par, v, [](i64 x) { return x > 60000; }));
+    assert(transform(par, v, [](i64 x) { return x * 2; }) == transform(v, [](i64 x) { return x * 2; }));
+    assert(filter(par, v, [](i64 x) { return x % 3 == 0; }) == filter(v, [](i64 x) { return x % 3 == 0; }));
+    assert(sorted(par, v) == sorted(v));
+    assert(reduce(par, v, [](i64 a, i64 b) { return a ^ b; }) == reduce(v, [](i64 a, i64 b) { return a ^ b; }));
+    assert(fold(par, v, i64{0}, [](i64 a, i64 x) { return a + (x & 1); }, [](i64 a, i64 b) { return a + b; })
+           == fold(v, i64{0}, [](i64 a, i64 x) { return a + (x & 1); }));
+
+    vi64 empty;
+    assert(sum(par, empty) == 0);
+    assert(sorted(par, empty).empty());
+
+    println("Parallel tests passed.");
+}
+
+fx testradixsort() {
+    vi64 v(200000);
+    for (size_t i = 0; i < v.size(); ++i) v[i] = static_cast<i64>(i * 2654435761ULL % 1000003) - 500000;
+    vi64 expect = v;
+    std::sort(expect.begin(), expect.end());
+
+    vi64 r = v;
+    radixsort(r);
+    assert(r == expect);
+    assert(sorted(v) == expect);
+
+    vi64 a = v;
+    sortasc(a);
+    assert(a == expect);
+    sortdesc(a);
+    assert(std::is_sorted(a.rbegin(), a.rend()));
+
+    vu32 u = {5, 0, 4000000000u, 7, 7};
+    radixsort(u);
+    assert(std::is_sorted(u.begin(), u.end()));
+
+    vpi64 p;
+    for (i64 i = 0; i < 5000; ++i) p.push_back({(i * 37) % 11 - 5, -(i * 101) % 997});
+    vpi64 pexpect = p;
+    std::sort(pexpect.begin(), pexpect.end());
+    radixsort(p);
+    assert(p == pexpect);
+
+    std::vector<std::tuple<i32, u8, i64>> t = {{1, 2, -3}, {-1, 9, 0}, {1, 2, -4}, {1, 1, 100}};
+    radixsort(t);
+    assert(std::is_sorted(t.begin(), t.end()));
+
+    vi64 d = v;
+    uniquify(d);
+    assert(std::adjacent_find(d.begin(), d.end()) == d.end() && std::is_sorted(d.begin(), d.end()));
+
+    println("Radix sort tests passed.");
+}
+
+fx testsimdreduce() {
+    // Every length around the vector widths, extremes placed at both ends and in the middle
+    for (size_t n = 1; n < 80; ++n) {
+        for (size_t at = 0; at < n; at += 7) {
+            vi64 a(n); vi32 b(n); vu64 c(n); vf64 d(n);
+            for (size_t i = 0; i < n; ++i) {
+                a[i] = static_cast<i64>(i * 31 % 17) - 8;
+                b[i] = static_cast<i32>(a[i]);
+                c[i] = static_cast<u64>(i * 31 % 17) + (1ULL << 63);
+                d[i] = static_cast<f64>(a[i]) * 0.5;
+            }
+            a[at] = 100; b[at] = -100; c[at] = 3; d[at] = -7.5;
+            assert(max(a).value() == *std::max_element(a.begin(), a.end()));
+            assert(argmax(a).value() == std::max_element(a.begin(), a.end()) - a.begin());
+            assert(argmin(b).value() == std::min_element(b.begin(), b.end()) - b.begin());
+            assert(min(c).value() == 3 && max(c).value() == *std::max_element(c.begin(), c.end()));
+            assert(argmin(d).value() == static_cast<i64>(at) && min(d).value() == -7.5);
+            assert(minmax(d).value() == std::make_pair(-7.5, *std::max_element(d.begin(), d.end())));
+            assert(sum(a) == std::accumulate(a.begin(), a.end(), i64{0}));
+            assert(sum(c) == std::accumulate(c.begin(), c.end(), u64{0}));
+        }
+    }
+
+    // Ties: first max for argmax, and minmax keeps std's first-min / last-max
+    vf64 z(40, 0.0);
+    z[3] = -0.0; z[30] = -0.0;
+    assert(std::signbit(max(z).value()) == std::signbit(*std::max_element(z.begin(), z.end())));
+    auto [lo, hi] = minmax(z).value();
+    auto [elo, ehi] = std::minmax_element(z.begin(), z.end());
+    assert(std::signbit(lo) == std::signbit(*elo) && std::signbit(hi) == std::signbit(*ehi));
+
+    // NaN falls back to std:: semantics
+    vf64 nan(50, 1.0);
+    nan[20] = std::nan("");
+    assert(argmax(nan).value() == std::max_element(nan.begin(), nan.end()) - nan.begin());
+
+    // Float sums are not reassociated
+    vf32 f(1000);
+    for (size_t i = 0; i < f.size(); ++i) f[i] = 1.0f / static_cast<f32>(i + 1);
+    assert(sum(f) == std::accumulate(f.begin(), f.end(), 0.0f));
+
+    List<i32> l;
+    for (i32 i = 0; i < 100; ++i) l.append(i * (i % 2 ? 1 : -1));
+    assert(l.max().value() == 99 && l.min().value() == -98 && l.sum() == 50);
+
+    println("SIMD reduction tests passed.");
+}
+
+fx testsimdsearch() {
+    for (size_t n = 0; n < 300; n += 13) {
+        vi64 a(n); vu8 b(n); vf32 c(n); vu32 d(n);
+        for (size_t i = 0; i < n; ++i) {
+            a[i] = static_cast<i64>(i % 23);
+            b[i] = static_cast<u8>(i % 23);
+            c[i] = static_cast<f32>(i % 23);
+            d[i] = static_cast<u32>(i % 23) + 4000000000u;
+        }
+        for (i64 x : {0, 5, 22, 23}) {
+            const i64 expect = static_cast<i64>(std::count(a.begin(), a.end(), x));
+            assert(count(a, x) == expect);
+            assert(count(b, static_cast<u8>(x)) == expect);
+            assert(count(c, static_cast<f32>(x)) == expect);
+            assert(count(d, static_cast<u32>(x) + 4000000000u) == expect);
+            assert(has(a, x) == (expect > 0));
+            assert(has(b, static_cast<u8>(x)) == (expect > 0));
+            assert(has(c, static_cast<f32>(x)) == (expect > 0));
+        }
+    }
+
+    // Mixed query types keep std::find semantics
+    vi64 v = {1, 2, 3};
+    assert(has(v, 2LL) && !has(v, 4LL));
+    assert(count(v, 2.0) == 1 && count(v, 2.5) == 0);
+
+    // NaN is never found, and -0.0 matches 0.0
+    vf64 f = {1.0, std::nan(""), -0.0};
+    assert(!has(f, std::nan("")) && has(f, 0.0));
+
+    List<i32> l;
+    for (i32 i = 0; i < 200; ++i) l.append(i % 50);
+    assert(l.indexof(49) == 49 && l.indexof(50) == -1);
+    assert(l.count(7) == 4 && l.has(0) && !l.has(-1));
+
+    println("SIMD search tests passed.");
+}
+
+fx testscans() {
+    for (size_t n : {0, 1, 7, 8, 9, 33, 1000}) {
+        vi64 a(n); vi32 b(n); vf64 c(n);
+        for (size_t i = 0; i < n; ++i) {
+            a[i] = static_cast<i64>(i * 37 % 11) - 5;
+            b[i] = static_cast<i32>(a[i]);
+            c[i] = 0.1 * static_cast<f64>(a[i]);
+        }
+        vi64 ea(n); std::partial_sum(a.begin(), a.end(), ea.begin());
+        vi32 eb(n); std::partial_sum(b.begin(), b.end(), eb.begin());
+        vf64 ec(n); std::partial_sum(c.begin(), c.end(), ec.begin());
+        assert(prefixsum(a) == ea && prefixsum(b) == eb && prefixsum(c) == ec);
+
+        vi64 s(n); std::partial_sum(a.rbegin(), a.rend(), s.rbegin());
+        assert(suffixsum(a) == s);
+        vi64 x = a; suffixsuminplace(x);
+        assert(x == s);
+        x = a; prefixsuminplace(x);
+        assert(x == ea);
+        x = a; differencesinplace(x);
+        assert(x == differences(a));
+
+        vi64 ex(n); std::exclusive_scan(a.begin(), a.end(), ex.begin(), i64{3});
+        assert(exclusivescan(a, i64{3}) == ex);
+        vi64 mx(n); std::inclusive_scan(a.begin(), a.end(), mx.begin(), [](i64 p, i64 q) { return std::max(p, q); });
+        assert(inclusivescan(a, [](i64 p, i64 q) { return std::max(p, q); }) == mx);
+    }
+
+    vi64 big(300001);
+    for (size_t i = 0; i < big.size(); ++i) big[i] = static_cast<i64>(i % 1000) - 400;
+    assert(prefixsum(par, big) == prefixsum(big));
+    auto mx = [](i64 p, i64 q) { return std::max(p, q); };
+    assert(inclusivescan(par, big, mx) == inclusivescan(big, mx));
+    vi64 inplace = big;
+    prefixsuminplace(par, inplace);
+    assert(inplace == prefixsum(big));
+
+    println("Scan tests passed.");
+}
+
+fx testviews() {
+    vi64 v = {1, 2, 3, 4, 5};
+    vi64 w = {6, 7};
+
+    auto t = takeview(v, 2);
+    assert(vi64(t.begin(), t.end()) == take(v, 2) && takeview(v, 99).size() == 5 && takeview(v, -1).empty());
+    auto d = dropview(v, 3);
+    assert(vi64(d.begin(), d.end()) == drop(v, 3) && dropview(v, 99).empty());
+    for (i64 s = -7; s <= 7; ++s) {
+        for (i64 e = -7; e <= 7; ++e) {
+            auto sv = sliceview(v, s, e);
+            assert(vi64(sv.begin(), sv.end()) == sliced(v, s, e));
+        }
+    }
+    assert(sliceview(v, 1, 3).data() == v.data() + 1);
+
+    auto c = chainview(v, w);
+    assert(c.size() == 7 && c[5] == 6 && c.tovector() == chain(v, w));
+    assert(vi64(c.begin(), c.end()) == chain(v, w));
+
+    vvi64 nested = {{}, {1, 2}, {}, {3}, {}};
+    auto f = flattenview(nested);
+    assert(f.size() == 3 && vi64(f.begin(), f.end()) == flatten(nested) && f.tovector() == flatten(nested));
+    vvi64 blank = {{}, {}};
+    assert(flattenview(blank).empty());
+
+    for (i64 k = -6; k <= 6; ++k) {
+        auto r = rotatedview(v, k);
+        assert(vi64(r.begin(), r.end()) == rotated(v, k) && r.tovector() == rotated(v, k));
+    }
+
+    List<i64> l = {1, 2, 3, 4};
+    auto ls = l.sliceview(1, -1);
+    assert(ls.size() == 2 && ls[0] == 2 && ls[1] == 3);
+
+    println("View tests passed.");
+}
+
+fx testparallelsort() {
+    const size_t n = 400000;
+    vi64 v(n);
+    for (size_t i = 0; i < n; ++i) v[i] = static_cast<i64>(i * 2654435761ULL % 1000003);
+    vi64 expect = v;
+    std::sort(expect.begin(), expect.end());
+    vi64 a = v;
+    parallelsort(a);
+    assert(a == expect);
+
+    // parallelsort falls back to one bucket on a single-core pool; cover the sample sort directly
+    std::less<> less;
+    a = v;
+    detail::samplesort(a, less);
+    assert(a == expect);
+    std::vector<str> sw(150000);
+    for (size_t i = 0; i < sw.size(); ++i) sw[i] = std::to_string(i * 7 % 13);
+    std::vector<str> swexpect = sw;
+    std::sort(swexpect.begin(), swexpect.end());
+    detail::samplesort(sw, less);
+    assert(sw == swexpect);
+
+    auto greater = [](i64 x, i64 y) { return x > y; };
+    assert(sorted(par, v, greater) == vi64(expect.rbegin(), expect.rend()));
+
+    // Heavy duplicates go through the equal-key buckets
+    vi64 dup(n);
+    for (size_t i = 0; i < n; ++i) dup[i] = static_cast<i64>(i * 7 % 5);
+    vi64 dupexpect = dup;
+    std::sort(dupexpect.begin(), dupexpect.end());
+    assert(sorted(par, dup) == dupexpect);
+    vi64 same(n, 42);
+    assert(sorted(par, same) == same);
+
+    std::vector<str> words(200000);
+    for (size_t i = 0; i < words.size(); ++i) words[i] = std::to_string(i * 7919 % 100003);
+    std::vector<str> wexpect = words;
+    std::sort(wexpect.begin(), wexpect.end());
+    parallelsort(words);
+    assert(words == wexpect);
+
+    println("Parallel sort tests passed.");
+}
+
+fx testargsort() {
+    for (size_t n : {0, 1, 10, 5000}) {
+        vi64 v(n);
+        for (size_t i = 0; i < n; ++i) v[i] = static_cast<i64>(i * 37 % 101) - 50;
+        vi64 order = argsort(v);
+        assert(order.size() == n);
+        for (size_t i = 1; i < n; ++i) assert(v[order[i - 1]] <= v[order[i]]);
+
+        vi64 stable = stableargsort(v, [](i64 x) { return x % 7; });
+        vi64 want(n);
+        std::iota(want.begin(), want.end(), i64{0});
+        std::stable_sort(want.begin(), want.end(), [&](i64 a, i64 b) { return v[a] % 7 < v[b] % 7; });
+        assert(stable == want);
+
+        std::vector<str> words(n);
+        for (size_t i = 0; i < n; ++i) words[i] = std::to_string(v[i]);
+        std::vector<str> byvalue = words;
+        i64 calls = 0;
+        stablesortby(byvalue, [&](const str& s) { ++calls; return std::stoll(s); });
+        assert(calls == static_cast<i64>(n));
+        std::vector<str> wexpect = words;
+        std::stable_sort(wexpect.begin(), wexpect.end(), [](const str& a, const str& b) { return std::stoll(a) < std::stoll(b); });
+        assert(byvalue == wexpect);
+
+        sortby(words, [](const str& s) { return s.size(); });
+        assert(std::is_sorted(words.begin(), words.end(), [](const str& a, const str& b) { return a.size() < b.size(); }));
+    }
+    println("Argsort tests passed.");
+}
+
+fx testdedupe() {
+    vi64 v;
+    for (i64 i = 0; i < 100000; ++i) v.push_back((i * 7919) % 1009 - 500);
+    vi64 firsts;
+    std::set<i64> seen;
+    for (i64 x : v) if (seen.insert(x).second) firsts.push_back(x);
+    assert(dedupe(v) == firsts);
+    assert(distinctcount(v) == 1009);
+    assert(dedupe(vi64{}).empty() && distinctcount(vi64{}) == 0);
+
+    std::vector<str> words = {"b", "a", "b", "c", "a"};
+    assert(dedupe(words) == std::vector<str>({"b", "a", "c"}));
+
+    HashSet<i64> h;
+    for (i64 i = 0; i < 5000; ++i) assert(h.add(i * 3));
+    assert(!h.add(0) && h.size() == 5000);
+    for (i64 i = 0; i < 5000; i += 2) assert(h.remove(i * 3));
+    assert(!h.remove(0) && h.size() == 2500);
+    for (i64 i = 0; i < 5000; ++i) assert(h.has(i * 3) == (i % 2 == 1));
+    i64 total = 0;
+    for (i64 x : h) total += x;
+    assert(total == [] { i64 t = 0; for (i64 i = 1; i < 5000; i += 2) t += i * 3; return t; }());
+    HashSet<i64> copy = h;
+    h.clear();
+    assert(h.empty() && copy.size() == 2500 && copy.has(3));
+
+    println("Dedupe tests passed.");
+}
+
+fx testcompress() {
+    vi64 v;
+    for (i64 i = 0; i < 10000; ++i) v.push_back((i * 7919) % 3001 - 1500);
+    auto [ranks, values] = compress(v);
+    vi64 expect = v;
+    uniquify(expect);
+    assert(values == expect);
+    for (size_t i = 0; i < v.size(); ++i) assert(values[ranks[i]] == v[i] && ranks[i] == indexlower(values, v[i]));
+
+    FenwickTree ft(static_cast<i64>(values.size()));
+    for (u32 r : ranks) ft.update(r, 1);
+    assert(ft.query(static_cast<i64>(values.size()) - 1) == static_cast<i64>(v.size()));
+
+    vi64 w = v;
+    assert(compressinplace(w) == values);
+    for (size_t i = 0; i < w.size(); ++i) assert(w[i] == static_cast<i64>(ranks[i]));
+    std::vector<i8> narrow;
+    for (i32 x = 127; x >= -128; x -= 2) narrow.push_back(static_cast<i8>(x));   // 128 distinct: ranks 0..127 fit
+    assert(compressinplace(narrow).size() == 128 && narrow.front() == 127 && narrow.back() == 0);
+
+    std::vector<str> s = {"pear", "apple", "pear", "fig"};
+    auto [sr, sv] = compress(s);
+    assert(sv == std::vector<str>({"apple", "fig", "pear"}) && sr == vu32({2, 0, 2, 1}));
+    assert(compress(vi64{}).second.empty());
+
+    println("Compress tests passed.");
+}
+
+fx teststaticsearch() {
+    for (i64 n : {0, 1, 2, 7, 8, 100, 1023, 1024, 5000}) {
+        vi64 v;
+        for (i64 i = 0; i < n; ++i) v.push_back((i / 3) * 2);   // runs of equal keys, gaps between
+        StaticSearch<i64> s(v);
+        assert(s.size() == static_cast<size_t>(n));
+        for (i64 x = -2; x <= (n / 3) * 2 + 2; ++x) {
+            assert(s.indexlower(x) == indexlower(v, x));
+            assert(s.indexupper(x) == indexupper(v, x));
+            assert(s.has(x) == binsearch(v, x));
+            assert(s.count(x) == count(v, x));
+        }
+    }
+
+    std::vector<str> words = {"apple", "fig", "kiwi", "pear"};
+    StaticSearch<str> ws(words);
+    assert(ws.indexlower("banana") == 1 && ws.indexupper("kiwi") == 3 && ws.indexlower("zzz") == 4);
+    assert(ws.has("pear") && !ws.has("plum"));
+
+    println("Static search tests passed.");
+}
+
+fx testmemo() {
+    i64 calls = 0;
+    auto paths = memoize<i64(i64, i64)>({20, 20}, [&](auto& self, i64 i, i64 j) -> i64 {
+        ++calls;
+        if (i == 0 || j == 0) return 1;
+        return self(i - 1, j) + self(i, j - 1);
+    });
+    assert(paths(16, 16) == 601080390);
+    assert(calls == 17 * 17 - 1 && paths.size() == static_cast<size_t>(calls));
+    paths.clear();
+    assert(paths.size() == 0 && paths(2, 2) == 6);
+
+    auto fib = memoize<u64(i32)>([](auto& self, i32 n) -> u64 { return n < 2 ? n : self(n - 1) + self(n - 2); });
+    assert(fib(90) == 2880067194370816120ULL && fib.size() == 91);
+
+    // Unbounded i64 pairs do not pack into 64 bits, so they go through the tuple table
+    auto gcdsteps = memoize<i64(i64, i64)>([](auto& self, i64 a, i64 b) -> i64 { return b == 0 ? 0 : 1 + self(b, a % b); });
+    assert(gcdsteps(1LL << 40, 3) == 2 && gcdsteps.size() == 3);
+    gcdsteps.clear();
+    assert(gcdsteps.size() == 0 && gcdsteps(8, 4) == 1);
+
+    auto editdist = memoize<i32(str, str)>([](auto& self, str a, str b) -> i32 {
+        if (a.empty() || b.empty()) return static_cast<i32>(a.size() + b.size());
+        if (a.back() == b.back()) return self(a.substr(0, a.size() - 1), b.substr(0, b.size() - 1));
+        return 1 + std::min({self(a.substr(0, a.size() - 1), b), self(a, b.substr(0, b.size() - 1)),
+                             self(a.substr(0, a.size() - 1), b.substr(0, b.size() - 1))});
+    });
+    assert(editdist("kitten", "sitting") == 3);
+
+    println("Memo tests passed.");
+}
+
+fx testrangemin() {
+    Random rng(5);
+    for (i64 n : {1, 2, 63, 64, 65, 200, 1000}) {
+        vi64 v(static_cast<size_t>(n));
+        for (auto& x : v) x = static_cast<i64>(rng.rand<u64>(0, 49)) - 25;
+        RangeMin<i64> rm(v);
+        assert(rm.size() == n);
+        for (i64 l = 0; l < n; l += 1 + n / 60)
+            for (i64 r = l; r < n; ++r)
+                assert(rm.query(l, r) == *std::min_element(v.begin() + l, v.begin() + r + 1));
+    }
+    println("Range min tests passed.");
+}
+
+int main() {
+    println("Running Algorithm Tests...");
+    testparallel();
+    testradixsort();
+    testsimdreduce();
+    testsimdsearch();
+    testscans();
+    testviews();
+    testparallelsort();
+    testargsort();
+    testdedupe();
+    testcompress();
+    teststaticsearch();
+    testmemo();
+    testrangemin();
+    println("All tests passed!");
+    return 0;
+}
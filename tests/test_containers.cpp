@@ -0,0 +1,370 @@
+#include <daxe.h>
+#include <cassert>
+
+using namespace dax;
+
+fx testtrie() {
+    Trie t;
+    for (strview w : {"car", "cart", "care", "cat", "dog", "car"}) t.add(w);
+    assert(t.size() == 6 && t.count("car") == 2 && t.has("cart") && !t.has("ca") && !t.has("Car"));
+    assert(t.countprefix("ca") == 5 && t.countprefix("") == 6 && t.hasprefix("do") && !t.hasprefix("x"));
+    assert(t.longestprefix("cartoon") == 4 && t.longestprefix("cab") == -1);
+    assert(t.withprefix("car") == std::vector<str>({"car", "care", "cart"}));
+    assert(t.remove("car") && t.count("car") == 1 && t.remove("car") && !t.remove("car"));
+    assert(t.withprefix("car") == std::vector<str>({"care", "cart"}) && t.longestprefix("carx") == -1);
+
+    // Other alphabets: digits
+    Trie<10, '0'> d;
+    d.add("0123");
+    assert(d.has("0123") && !d.has("0124") && d.nodes() == 5);
+
+    Random rng(4242);
+    Trie big;
+    std::map<str, i64> ref;
+    for (i32 i = 0; i < 20000; ++i) {
+        str w;
+        for (u64 len = rng.rand<u64>(1, 6); len > 0; --len) w += static_cast<char>('a' + rng.rand<u64>(0, 3));
+        if (rng.rand<u64>(0, 3) == 0) { bool had = ref[w] > 0; assert(big.remove(w) == had); if (had) --ref[w]; }
+        else { big.add(w); ++ref[w]; }
+    }
+    for (const auto& [w, c] : ref) {
+        assert(big.count(w) == c);
+        i64 pc = 0;
+        for (const auto& [x, cx] : ref) if (x.compare(0, w.size(), w) == 0) pc += cx;
+        assert(big.countprefix(w) == pc);
+    }
+
+    println("Trie tests passed.");
+}
+
+fx testbinarytrie() {
+    BinaryTrie<4> b;
+    for (u64 x : {3, 5, 5, 12}) b.add(x);
+    assert(b.size() == 4 && b.count(5) == 2 && !b.has(4) && !b.has(100));
+    assert(b.min() == 3 && b.max() == 12 && b.kth(1) == 5 && b.kth(2) == 5);
+    assert(b.xormax(6) == (6 ^ 12) && b.xormin(6) == (6 ^ 5) && b.countless(6) == 3 && b.countless(99) == 4);
+    assert(b.remove(5) && b.count(5) == 1 && !b.remove(4));
+
+    Random rng(31337);
+    BinaryTrie<> t;
+    vu64 ref;
+    t.reserve(2000);
+    for (i32 i = 0; i < 2000; ++i) {
+        const u64 x = rng.rand<u64>(0, ~u64{0});
+        t.add(x);
+        ref.push_back(x);
+    }
+    std::sort(ref.begin(), ref.end());
+    for (i32 q = 0; q < 300; ++q) {
+        const u64 x = q % 3 ? rng.rand<u64>(0, ~u64{0}) : ref[rng.rand<u64>(0, ref.size() - 1)];
+        u64 lo = ~u64{0}, hi = 0;
+        for (u64 y : ref) { lo = std::min(lo, x ^ y); hi = std::max(hi, x ^ y); }
+        assert(t.xormin(x) == lo && t.xormax(x) == hi);
+        assert(t.countless(x) == std::lower_bound(ref.begin(), ref.end(), x) - ref.begin());
+        const i64 k = static_cast<i64>(rng.rand<u64>(0, ref.size() - 1));
+        assert(t.kth(k) == ref[static_cast<size_t>(k)]);
+    }
+
+    println("Binary trie tests passed.");
+}
+
+fx testintern() {
+    StringPool pool;
+    const Symbol a = pool.intern("apple"), b = pool.intern("banana");
+    assert(a != b && pool.intern(str("apple")) == a && pool.size() == 2 && pool.bytes() == 11);
+    assert(pool[a] == "apple" && pool.tostr(b) == "banana" && pool.has("apple") && !pool.has("cherry"));
+    assert(pool.lookup("banana").unwrap() == b && pool.lookup("cherry").isnone() && pool.size() == 2);
+    assert(pool.intern("") == pool.intern("") && pool[pool.intern("")].empty());
+    assert(std::hash<Symbol>{}(a) != std::hash<Symbol>{}(b));
+
+    // Views stay valid as chunks fill up and the pool moves
+    std::vector<str> words;
+    std::vector<Symbol> syms;
+    for (i32 i = 0; i < 30000; ++i) {
+        words.push_back("w" + std::to_string(i * 7919 % 10007) + (i % 1000 == 0 ? str(20000, 'x') : str()));
+        syms.push_back(pool.intern(words.back()));
+    }
+    StringPool moved = std::move(pool);
+    for (size_t i = 0; i < words.size(); ++i) assert(moved[syms[i]] == words[i] && moved.intern(words[i]) == syms[i]);
+
+    StringPool text;
+    SymbolDict<i64> freq;
+    for (Symbol w : text.tokens("  the cat\tsat on\nthe mat the  ")) ++freq[w];
+    const Symbol the = text.lookup("the").unwrap();
+    assert(text.size() == 5 && freq[the] == 3 && freq.size() == 5 && freq.getor(text.intern("dog"), -1) == -1);
+    assert(freq.keys().size() == 5 && freq.keys()[0] == the && freq.values()[0] == 3);
+    assert(freq.pop(the).unwrap() == 3 && !freq.has(the) && freq.size() == 4 && !freq.remove(the));
+    assert(freq.setdefault(the, 7) == 7 && freq.getat(the).unwrap() == 7);
+
+    SymbolSet x{Symbol{1}, Symbol{5}, Symbol{200}}, y{Symbol{5}, Symbol{6}};
+    assert(x.size() == 3 && x.has(Symbol{200}) && !x.has(Symbol{6}) && !x.add(Symbol{5}));
+    assert(x.unite(y).size() == 4 && x.intersect(y).tolist().vec() == std::vector<Symbol>({Symbol{5}}));
+    assert(x.difference(y).size() == 2 && x.intersect(y).issubset(y) && !x.issubset(y));
+    assert(x.remove(Symbol{200}) && x.tolist().vec() == std::vector<Symbol>({Symbol{1}, Symbol{5}}));
+
+    println("Interning tests passed.");
+}
+
+fx testhashdict() {
+    HashDict<str, i64> d{{"a", 1}, {"b", 2}};
+    d["c"] = 3;
+    d.set("a", 10);
+    assert(d.size() == 3 && d.has("a") && d.getor("a", 0) == 10 && d.getor("z", -1) == -1 && d.at("b") == 2);
+    assert(d.getat("c").unwrap() == 3 && d.getat("z").isnone() && d.count("b") == 1 && !d.contains("z"));
+    assert(d.setdefault("b", 99) == 2 && d.setdefault("d", 4) == 4 && d.size() == 4);
+    assert(d.pop("a").unwrap() == 10 && d.pop("a").isnone() && !d.remove("a") && d.erase("d") == 1);
+    auto keys = d.keys().vec();
+    std::sort(keys.begin(), keys.end());
+    assert(keys == std::vector<str>({"b", "c"}) && d.values().sum() == 5 && d.items().size() == 2);
+    HashDict<str, i64> e{{"c", 30}, {"e", 5}};
+    d.update(e);
+    assert(d.size() == 3 && d["c"] == 30 && d["e"] == 5);
+    i64 total = 0;
+    for (const auto& [k, v] : d) total += v;
+    assert(total == 37);
+
+    // Random inserts and erases against Dict, including probe runs that wrap
+    Random rng(8080);
+    HashDict<u64, i64> h;
+    Dict<u64, i64> ref;
+    for (i32 i = 0; i < 200000; ++i) {
+        const u64 k = rng.rand<u64>(0, 4999);
+        switch (rng.rand<u64>(0, 3)) {
+            case 0: assert(h.remove(k) == ref.remove(k)); break;
+            case 1: assert(h.getor(k, -1) == ref.getor(k, -1)); break;
+            default: h[k] += static_cast<i64>(i); ref[k] += static_cast<i64>(i); break;
+        }
+        if (i % 50000 == 0) h.clear(), ref.clear();
+    }
+    assert(h.size() == ref.size());
+    for (const auto& [k, v] : ref) assert(h.at(k) == v);
+    i64 seen = 0;
+    for (const auto& [k, v] : h) { assert(ref.getor(k, -1) == v); ++seen; }
+    assert(seen == static_cast<i64>(ref.size()));
+
+    println("HashDict tests passed.");
+}
+
+fx testhasher() {
+    const Hash h;
+    const str s = "hello, world";
+    assert(h(s) == h(strview(s)) && h(s) == h("hello, world") && h(s) != h(str("hello, worle")));
+    for (size_t n = 0; n < 100; ++n) {
+        // Every length path, and a change in any byte shows up
+        str a(n, 'q'), b = a;
+        if (n) b[n / 2] = 'r';
+        assert(h(a) == h(str(n, 'q')) && (n == 0 || h(a) != h(b)));
+    }
+    assert(h(pi64{1, 2}) != h(pi64{2, 1}) && h(pi64{1, 2}) == h(std::make_pair(i64{1}, i64{2})));
+    assert(h(std::make_tuple(1, str("a"), 2.5)) == h(std::make_tuple(1, str("a"), 2.5)));
+    assert(h(vi64{1, 2, 3}) != h(vi64{1, 2}) && h(std::array<i32, 2>{4, 5}) != h(std::array<i32, 2>{5, 4}));
+    assert(h(0.0) == h(-0.0) && h(i64{7}) != h(i64{8}) && h(Symbol{3}) != h(Symbol{4}));
+
+    // Bytes that cancel the final mix constant must still depend on the seed
+    Hash h1, h2;
+    h1.seed = 1;
+    h2.seed = 2;
+    for (size_t n : {12, 16, 24, 40, 100}) {
+        std::vector<u64> seen;
+        for (char fill = 'a'; fill < 'e'; ++fill) {
+            str s(n, fill);
+            if (n <= 16) {
+                const u32 hi = static_cast<u32>(detail::WYP1 >> 32), lo = static_cast<u32>(detail::WYP1);
+                std::memcpy(&s[0], &hi, 4);
+                std::memcpy(&s[(n >> 3) << 2], &lo, 4);
+            } else {
+                std::memcpy(&s[n - 16], &detail::WYP1, 8);
+            }
+            assert(h1(s) != h2(s));
+            seen.push_back(h1(s));
+        }
+        std::sort(seen.begin(), seen.end());
+        assert(std::unique(seen.begin(), seen.end()) == seen.end());
+    }
+
+    // Sequential keys spread over the low bits that bucket indices use
+    std::vector<i32> buckets(64, 0);
+    for (i64 i = 0; i < 64000; ++i) ++buckets[h(i * 1024) & 63];
+    for (i32 c : buckets) assert(c > 800 && c < 1200);
+
+    umpi64i64 grid;
+    uset<std::tuple<i32, i32, i32>> cubes;
+    for (i64 x = 0; x < 100; ++x) {
+        grid[{x, x * x}] += x;
+        cubes.insert({static_cast<i32>(x), 1, 2});
+    }
+    assert(grid.size() == 100 && grid.at({9, 81}) == 9 && cubes.count({5, 1, 2}) == 1);
+    HashDict<pi64, i64> pairs{{{1, 2}, 3}};
+    assert(pairs.getor({1, 2}, 0) == 3 && pairs.getor({2, 1}, 0) == 0);
+
+    println("Hasher tests passed.");
+}
+
+fx testflat() {
+    FlatSet<i64> s{5, 1, 3, 3, 9};
+    assert(s.size() == 4 && s.vec() == vi64({1, 3, 5, 9}) && s.has(3) && !s.has(4) && s[0] == 1);
+    assert(s.add(4) && !s.add(4) && s.remove(9) && !s.remove(9) && s.rank(4) == 2);
+    s.update(vi64{10, 0, 5, 7});
+    assert(s.vec() == vi64({0, 1, 3, 4, 5, 7, 10}) && s.pop().unwrap() == 0 && s.size() == 6);
+    FlatSet<i64> t{3, 4, 8};
+    assert(s.unite(t).vec() == vi64({1, 3, 4, 5, 7, 8, 10}) && s.intersect(t).vec() == vi64({3, 4}));
+    assert(s.difference(t).vec() == vi64({1, 5, 7, 10}) && s.symmetricdiff(t).vec() == vi64({1, 5, 7, 8, 10}));
+    assert(FlatSet<i64>({3, 4}).issubset(s) && !t.issubset(s) && s.issuperset(FlatSet<i64>{1, 10}));
+
+    FlatMap<str, i64> m{{"b", 2}, {"a", 1}, {"b", 20}};
+    m["c"] = 3;
+    assert(m.size() == 3 && m.getor("b", 0) == 2 && m.keys().vec() == std::vector<str>({"a", "b", "c"}));
+    assert(m.getat("z").isnone() && m.setdefault("a", 9) == 1 && m.pop("a").unwrap() == 1 && !m.has("a"));
+    m.update(FlatMap<str, i64>{{"c", 30}, {"d", 4}});
+    assert(m.values().vec() == vi64({2, 30, 4}) && m.remove("d") && !m.remove("d") && m.items().size() == 2);
+
+    // Set and FlatSet algebra against a reference, balanced and lopsided
+    Random rng(9090);
+    for (i32 round = 0; round < 60; ++round) {
+        const u64 na = rng.rand<u64>(0, 399), nb = round % 3 == 0 ? rng.rand<u64>(0, 7) : rng.rand<u64>(0, 399), range = rng.rand<u64>(1, 600);
+        vi64 va, vb;
+        for (u64 i = 0; i < na; ++i) va.push_back(static_cast<i64>(rng.rand<u64>(0, range - 1)));
+        for (u64 i = 0; i < nb; ++i) vb.push_back(static_cast<i64>(rng.rand<u64>(0, range - 1)));
+        if (round % 2) std::swap(va, vb);
+        const Set<i64> a(va.begin(), va.end()), b(vb.begin(), vb.end());
+        const FlatSet<i64> fa(va), fb(vb);
+        std::vector<i64> both, left, either, odd;
+        std::set_intersection(a.begin(), a.end(), b.begin(), b.end(), std::back_inserter(both));
+        std::set_difference(a.begin(), a.end(), b.begin(), b.end(), std::back_inserter(left));
+        std::set_union(a.begin(), a.end(), b.begin(), b.end(), std::back_inserter(either));
+        std::set_symmetric_difference(a.begin(), a.end(), b.begin(), b.end(), std::back_inserter(odd));
+        const bool sub = std::includes(b.begin(), b.end(), a.begin(), a.end());
+        assert(fa.vec() == a.tolist().vec());
+        assert(a.intersect(b).tolist().vec() == both && fa.intersect(fb).vec() == both);
+        assert(a.difference(b).tolist().vec() == left && fa.difference(fb).vec() == left);
+        assert(a.unite(b).tolist().vec() == either && fa.unite(fb).vec() == either);
+        assert(a.symmetricdiff(b).tolist().vec() == odd && fa.symmetricdiff(fb).vec() == odd);
+        assert(a.issubset(b) == sub && fa.issubset(fb) == sub && a.intersect(b).issubset(a));
+        assert(fb.difference(fa).vec() == b.difference(a).tolist().vec());
+        FlatSet<i64> grown = fa;
+        grown.update(vb);
+        assert(grown == fa.unite(fb));
+    }
+
+    println("Flat container tests passed.");
+}
+
+fx testsmalllist() {
+    SmallList<i64, 4> a{3, 1, 2};
+    assert(a.size() == 3 && !a.spilled() && a.sum() == 6 && a.max().unwrap() == 3 && a.indexof(2) == 2);
+    a.append(5);
+    a.append(4);
+    assert(a.size() == 5 && a.spilled() && a.capacity() >= 5 && a.getat(-1).unwrap() == 4 && a.getor(9, -1) == -1);
+    assert(a.slice(1, -1).tolist().vec() == vi64({1, 2, 5}) && a.sorted().tolist().vec() == vi64({1, 2, 3, 4, 5}));
+    a.insertat(0, 9);
+    a.removeat(-2);
+    assert(a.remove(1) && !a.remove(7) && a.tolist().vec() == vi64({9, 3, 2, 4}) && a.pop().unwrap() == 4);
+    assert(a.filter([](i64 x) { return x > 2; }).size() == 2 && a.transform([](i64 x) { return x * 0.5; })[0] == 4.5);
+    assert(a.any([](i64 x) { return x == 2; }) && a.every([](i64 x) { return x > 1; }) && a.count(3) == 1);
+
+    // Strings exercise element moves across the inline/heap boundary
+    SmallList<str, 2> w{"a", "b"};
+    w.append(w[0]);
+    SmallList<str, 2> moved = std::move(w), copy = moved;
+    assert(moved.size() == 3 && moved[2] == "a" && w.empty() && copy == moved);
+    SmallList<str, 2> one{"x"}, other = std::move(one);
+    assert(!other.spilled() && other[0] == "x" && one.empty());
+    other = copy;
+    copy = std::move(other);
+    assert(copy.size() == 3 && copy.reversed()[0] == "a");
+
+    StaticVec<i32, 8> s(3, 7);
+    s.extend(std::vector<i32>{1, 2});
+    assert(s.size() == 5 && s.capacity() == 8 && !s.full() && s.sum() == 24 && s.min(0) == 1);
+    s.sort();
+    assert(s.tolist().vec() == std::vector<i32>({1, 2, 7, 7, 7}) && s.pop(0) == 7);
+    s.unique();
+    assert(s.size() == 3 && s.has(7) && s.indexof(9) == -1);
+    StaticVec<str, 3> t{"p", "q"}, u = std::move(t);
+    assert(u.size() == 2 && u[1] == "q" && t.empty());
+
+    // Random edits against std::vector, small and spilled
+    Random rng(777);
+    SmallList<str, 3> l;
+    std::vector<str> ref;
+    for (i32 i = 0; i < 20000; ++i) {
+        const str x = std::to_string(rng.rand<u64>(0, 19));
+        switch (rng.rand<u64>(0, 5)) {
+            case 0: { const i64 k = static_cast<i64>(rng.rand<u64>(0, ref.size())); l.insertat(k, x); ref.insert(ref.begin() + k, x); break; }
+            case 1: if (!ref.empty()) { const i64 k = static_cast<i64>(rng.rand<u64>(0, ref.size() - 1)); l.removeat(k); ref.erase(ref.begin() + k); } break;
+            case 2: { auto it = std::find(ref.begin(), ref.end(), x); assert(l.remove(x) == (it != ref.end())); if (it != ref.end()) ref.erase(it); break; }
+            case 3: if (ref.size() > 40) { l.clear(); ref.clear(); } break;
+            default: l.append(x); ref.push_back(x); break;
+        }
+        assert(l.size() == ref.size());
+    }
+    assert(std::equal(l.begin(), l.end(), ref.begin(), ref.end()));
+
+    println("SmallList tests passed.");
+}
+
+fx testchunkedlist() {
+    ChunkedList<i64> c{4, 8, 15, 16, 23, 42};
+    c.insertat(2, 9);
+    c.insertat(-1, 99);
+    c.insertat(100, 7);
+    assert(c.size() == 9 && c[2] == 9 && c.getat(-2).unwrap() == 42 && c.getor(9, -1) == -1 && c.back() == 7);
+    assert(c.indexof(99) == 6 && c.count(16) == 1 && c.has(23) && !c.has(5) && c.sum() == 223 && c.max().unwrap() == 99);
+    c.removeat(-3);
+    assert(c.remove(9) && !c.remove(9) && c.tolist().vec() == vi64({4, 8, 15, 16, 23, 42, 7}) && c.pop().unwrap() == 7);
+    assert(c.slice(1, -1).tolist().vec() == vi64({8, 15, 16, 23}) && c.reversed().front() == 42);
+    ChunkedList<i64> tail = c.split(4);
+    assert(c.tolist().vec() == vi64({4, 8, 15, 16}) && tail.tolist().vec() == vi64({23, 42}));
+    tail.concat(c);
+    assert(tail.tolist().vec() == vi64({23, 42, 4, 8, 15, 16}) && tail.sorted().tolist().vec() == vi64({4, 8, 15, 16, 23, 42}));
+    assert(tail.filter([](i64 x) { return x % 2 == 0; }).size() == 4 && tail.transform([](i64 x) { return x * 0.5; })[0] == 11.5);
+
+    // Random edits against std::vector, across many block splits and merges
+    Random rng(2024);
+    ChunkedList<i64> l;
+    vi64 ref;
+    for (i32 i = 0; i < 60000; ++i) {
+        const i64 x = static_cast<i64>(rng.rand<u64>(0, 999));
+        const i64 k = static_cast<i64>(rng.rand<u64>(0, ref.size()));
+        switch (rng.rand<u64>(0, 7)) {
+            case 0: case 1: if (!ref.empty()) { l.removeat(k % static_cast<i64>(ref.size())); ref.erase(ref.begin() + k % static_cast<i64>(ref.size())); } break;
+            case 2: { auto it = std::find(ref.begin(), ref.end(), x); assert(l.remove(x) == (it != ref.end())); if (it != ref.end()) ref.erase(it); break; }
+            case 3: if (!ref.empty()) { const size_t j = static_cast<size_t>(k) % ref.size(); assert(l[j] == ref[j]); l[j] = x; ref[j] = x; } break;
+            case 4: if (i % 97 == 0) {
+                ChunkedList<i64> rest = l.split(k);
+                assert(l.size() == static_cast<size_t>(k) && rest.size() == ref.size() - static_cast<size_t>(k));
+                l.concat(std::move(rest));
+            } break;
+            default: l.insertat(k, x); ref.insert(ref.begin() + k, x); break;
+        }
+        assert(l.size() == ref.size());
+    }
+    assert(l.tolist().vec() == ref && std::equal(l.begin(), l.end(), ref.begin(), ref.end()) && l.blocks() < ref.size() / 8);
+    l.sort();
+    std::sort(ref.begin(), ref.end());
+    assert(l.tolist().vec() == ref && l.indexof(ref.back()) == std::find(ref.begin(), ref.end(), ref.back()) - ref.begin());
+
+    // Delete-heavy edits must not leave a long tail of tiny blocks
+    ChunkedList<i64> shrink;
+    for (i64 i = 0; i < 1000000; ++i) shrink.append(i);
+    for (i64 j = 0; shrink.size() > 5000; ++j)   // left to right, keeping 5 of every 1000
+        for (i32 k = 0; k < 995; ++k) shrink.removeat(j * 5 + 5);
+    assert(shrink.size() == 5000 && shrink.blocks() <= 2 * shrink.size() / 71 + 2);
+    for (size_t i = 1; i < shrink.size(); ++i) assert(shrink[i - 1] < shrink[i]);
+
+    println("ChunkedList tests passed.");
+}
+
+int main() {
+    println("Running Container Tests...");
+    testtrie();
+    testbinarytrie();
+    testintern();
+    testhashdict();
+    testhasher();
+    testflat();
+    testsmalllist();
+    testchunkedlist();
+    println("All tests passed!");
+    return 0;
+}
@@ -0,0 +1,390 @@
+#include <daxe.h>
+#include <cassert>
+#if defined(__unix__)
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+using namespace dax;
+
+// Reference implementations: the <cctype> loops the vector kernels replace
+static str reflower(str s) { for (auto& c : s) c = static_cast<char>(std::tolower(static_cast<unsigned char>(c))); return s; }
+static str refupper(str s) { for (auto& c : s) c = static_cast<char>(std::toupper(static_cast<unsigned char>(c))); return s; }
+
+// True if f() terminates the process (a panic), run in a child so the test survives
+template <typename F>
+static bool panics(F f) {
+#if defined(__unix__)
+    std::cout.flush();
+    const pid_t pid = fork();
+    if (pid == 0) {
+        std::freopen("/dev/null", "w", stderr);
+        f();
+        std::_Exit(0);
+    }
+    int status = 0;
+    waitpid(pid, &status, 0);
+    return !(WIFEXITED(status) && WEXITSTATUS(status) == 0);
+#else
+    (void)f;
+    return true;
+#endif
+}
+
+fx testcase() {
+    str all;
+    for (i32 c = 0; c < 256; ++c) all += static_cast<char>(c);
+    // Every byte value, at every alignment and in blocks with and without non-ASCII bytes
+    for (size_t off = 0; off < 40; ++off) {
+        str s = all.substr(off) + all.substr(0, off) + str("Hello, World! 0123 ABCxyz_[`{@") + all.substr(0, 100);
+        assert(lowercase(s) == reflower(s) && uppercase(s) == refupper(s));
+        str t = s;
+        lowercaseinplace(t);
+        assert(t == reflower(s));
+        uppercaseinplace(t);
+        assert(t == refupper(s));
+    }
+    str big(1000, 'Q');
+    big[517] = 'z';
+    assert(lowercase(big) == reflower(big) && uppercase(big) == refupper(big));
+    assert(lowercase("") == "" && uppercase(strview("mIxEd")) == "MIXED");
+
+    assert(capitalize("hELLO wORLD") == "Hello world");
+    assert(title("hello   wORLD\tfoo\nbar") == "Hello   World\tFoo\nBar");
+    str t = "the QUICK brown fox jumps over the lazy dog, 42 times";
+    titleinplace(t);
+    assert(t == "The Quick Brown Fox Jumps Over The Lazy Dog, 42 Times");
+    capitalizeinplace(t);
+    assert(t == "The quick brown fox jumps over the lazy dog, 42 times");
+
+    println("Case mapping tests passed.");
+}
+
+fx testpredicates() {
+    const str letters = "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ";
+    assert(isalpha(letters + letters) && !isalnum(letters + "_") && isalnum(letters + "0123456789"));
+    assert(isdigit(str(100, '7')) && !isdigit(str(100, '7') + "x") && !isdigit(""));
+    for (i32 c = 0; c < 256; ++c) {
+        str s(70, 'a');
+        s[40] = static_cast<char>(c);
+        assert(isalpha(s) == (std::isalpha(c) != 0));
+        assert(isalnum(s) == (std::isalnum(c) != 0));
+        s = str(70, '5');
+        s[69] = static_cast<char>(c);
+        assert(isdigit(s) == (std::isdigit(c) != 0));
+    }
+    println("Predicate tests passed.");
+}
+
+fx teststrip() {
+    assert(strip("  hello  ") == "hello" && strip("   ") == "" && strip("") == "");
+    assert(lstrip("\t\n hi \r") == "hi \r" && rstrip("\t\n hi \r") == "\t\n hi");
+    str pad(70, ' ');
+    str s = pad + "\tx y\n" + pad + "\r";
+    assert(strip(s) == "x y" && lstrip(s) == "x y\n" + pad + "\r" && rstrip(s) == pad + "\tx y");
+    assert(stripview(s) == "x y" && stripview(s).data() == s.data() + 71);
+    assert(lstripview(pad).empty() && rstripview(pad).empty());
+
+    str u = s;
+    stripinplace(u);
+    assert(u == "x y");
+    u = s;
+    lstripinplace(u);
+    assert(u == lstrip(s));
+    u = s;
+    rstripinplace(u);
+    assert(u == rstrip(s));
+    u = "\v keep \f";   // only ' ', \t, \n, \r are stripped
+    stripinplace(u);
+    assert(u == "\v keep \f");
+    println("Strip tests passed.");
+}
+
+// Leftmost-longest reference: try patterns at each position, longest first
+static str refreplaceall(const str& s, const std::vector<std::pair<str, str>>& m) {
+    str r;
+    for (size_t i = 0; i < s.size();) {
+        i64 best = -1;
+        for (size_t k = 0; k < m.size(); ++k) {
+            const str& p = m[k].first;
+            if (!p.empty() && s.compare(i, p.size(), p) == 0 && (best < 0 || p.size() > m[best].first.size())) best = static_cast<i64>(k);
+        }
+        if (best < 0) { r += s[i++]; continue; }
+        r += m[best].second;
+        i += m[best].first.size();
+    }
+    return r;
+}
+
+fx testreplace() {
+    assert(replace("aaaa", "aa", "b") == "bb" && replace("abc", "", "x") == "abc");
+    assert(replace("a.b.c", ".", "::") == "a::b::c" && replace("xyz", "q", "r") == "xyz");
+    assert(replace(str(1000, 'a'), "a", "bc") == repeatstr("bc", 1000));
+    assert(replace("hello world", "world", "") == "hello ");
+
+    assert(join(std::vector<str>{"a", "b", "c"}, ", ") == "a, b, c" && join(std::vector<str>{}) == "");
+    assert(join(std::vector<strview>{"x", "y"}, "-") == "x-y" && join(std::vector<str>{"solo"}) == "solo");
+    assert(join(std::vector<const char*>{"p", "q"}) == "p q");
+
+    assert(replaceall("the cat sat on the mat", {{"cat", "dog"}, {"mat", "rug"}, {"the", "a"}}) == "a dog sat on a rug");
+    assert(replaceall("abcd", {{"bc", "X"}, {"abcd", "Y"}}) == "Y");          // leftmost wins
+    assert(replaceall("abcdx", {{"abcde", "1"}, {"ab", "2"}, {"d", "3"}}) == "2c3x");
+    assert(replaceall("aaaa", {{"a", "b"}, {"aa", "c"}}) == "cc");             // longest wins
+    assert(replaceall("ab", {{"a", "b"}, {"b", "a"}}) == "ba");                // simultaneous, no chaining
+    std::map<str, str> m = {{"he", "HE"}, {"she", "SHE"}, {"hers", "HERS"}};
+    assert(replaceall("ushers", m) == "uSHErs");
+
+    // Random patterns over a tiny alphabet, against the brute-force reference
+    Random rng(12345);
+    for (i32 round = 0; round < 300; ++round) {
+        std::vector<std::pair<str, str>> pats;
+        const u64 k = rng.rand<u64>(1, 6);
+        for (u64 j = 0; j < k; ++j) {
+            str p;
+            for (u64 len = rng.rand<u64>(0, 4); len > 0; --len) p += static_cast<char>('a' + rng.rand<u64>(0, 2));
+            pats.push_back({p, std::to_string(j)});
+        }
+        str text;
+        for (u64 len = rng.rand<u64>(0, 59); len > 0; --len) text += static_cast<char>('a' + rng.rand<u64>(0, 2));
+        // duplicate patterns: the reference keeps the first, like AhoCorasick
+        std::vector<std::pair<str, str>> firsts;
+        for (auto& pr : pats) {
+            bool seen = false;
+            for (auto& f : firsts) seen = seen || f.first == pr.first;
+            if (!seen) firsts.push_back(pr);
+        }
+        assert(replaceall(text, pats) == refreplaceall(text, firsts));
+    }
+
+    AhoCorasick ac({"he", "she", "his", "hers"});
+    assert(ac.count("ushers") == 3 && ac.count("") == 0 && ac.size() == 4);
+    std::vector<std::pair<size_t, u32>> hits;
+    ac.scan("ushers", [&](size_t end, u32 id) { hits.push_back({end, id}); });
+    assert(hits == (std::vector<std::pair<size_t, u32>>{{4, 1}, {4, 0}, {6, 3}}));
+
+    // One replacement per pattern; a short list panics instead of reading past it
+    AhoCorasick abc({"a", "b", "c"});
+    assert(replaceall("abcd", abc, {"X", "Y", "Z"}) == "XYZd");
+    assert(panics([&] { (void)replaceall("abc", abc, {"X"}); }));
+
+    println("Replace tests passed.");
+}
+
+fx testhash() {
+    const str s = "abracadabra_abracadabra";
+    StringHash h(s);
+    assert(h.size() == s.size() && h.hash() == h.substr(0, s.size()));
+    for (size_t l1 = 0; l1 < s.size(); ++l1)
+        for (size_t l2 = 0; l2 < s.size(); ++l2)
+            for (size_t len = 0; l1 + len <= s.size() && l2 + len <= s.size(); ++len)
+                assert(h.equal(l1, l2, len) == (s.compare(l1, len, s, l2, len) == 0));
+    for (size_t i = 0; i < s.size(); ++i)
+        for (size_t j = 0; j < s.size(); ++j) {
+            size_t want = 0;
+            while (i + want < s.size() && j + want < s.size() && s[i + want] == s[j + want]) ++want;
+            assert(h.lcp(i, j) == want);
+        }
+
+    // Hashes from different strings share the base, so they compare and concatenate
+    StringHash a("abra"), b("cadabra"), whole("abracadabra");
+    assert(a.hash() == h.substr(0, 4) && whole.hash() == h.substr(12, 23));
+    assert(a.concat(a.hash(), b.hash(), b.size()) == whole.hash());
+    assert(a.concat(a.hash(), a.hash(), 4) == StringHash("abraabra").hash());
+    assert(whole.lcp(7, a, 0) == 4 && StringHash("").hash() == 0);
+
+    vi64 v = {5, -3, 1LL << 62, 5, -3, 1LL << 62, 7};
+    StringHash hv(v);
+    assert(hv.equal(0, 3, 3) && !hv.equal(0, 4, 3) && hv.lcp(0, 3) == 3);
+    assert(StringHash(vi64{-1}).hash() != StringHash(vi64{1}).hash());
+    // Zero elements and 64-bit values equal mod 2^61 - 1 must not collide
+    assert(StringHash(vi64{0, 7}).hash() != StringHash(vi64{7}).hash());
+    assert(StringHash(strview("\0a", 2)).hash() != StringHash("a").hash());
+    assert(StringHash(vi64{1}).hash() != StringHash(vi64{i64{1} << 61}).hash());
+    assert(StringHash(vi32{0, 5}).hash() != StringHash(vi32{5}).hash());
+    const StringHash hw(vi64{3, -4, 3, -4});
+    assert(hw.equal(0, 2, 2) && !hw.equal(0, 1, 2) && hw.concat(hw.substr(0, 2), hw.substr(2, 4), 2) == hw.hash());
+    assert(StringHash::mul(StringHash::MOD - 1, StringHash::MOD - 1) == 1);
+
+    println("String hash tests passed.");
+}
+
+fx testmatching() {
+    assert(prefixfunction("abacaba") == vu32({0, 0, 1, 0, 1, 2, 3}));
+    assert(zfunction("aabxaab") == vu32({7, 1, 0, 0, 3, 1, 0}));
+    assert(prefixfunction(vi64{1, 2, 1, 2}) == vu32({0, 0, 1, 2}) && zfunction("").empty());
+    assert(findall("aaaa", "aa") == vi64({0, 1, 2}) && findall("abc", "") == vi64{} && findall("ab", "abc") == vi64{});
+
+    Random rng(777);
+    for (i32 round = 0; round < 500; ++round) {
+        str t, p;
+        for (u64 len = rng.rand<u64>(0, 199); len > 0; --len) t += static_cast<char>('a' + rng.rand<u64>(0, 1));
+        for (u64 len = rng.rand<u64>(1, 6); len > 0; --len) p += static_cast<char>('a' + rng.rand<u64>(0, 1));
+        vi64 want;
+        for (size_t i = 0; i + p.size() <= t.size(); ++i) if (t.compare(i, p.size(), p) == 0) want.push_back(static_cast<i64>(i));
+        assert(findall(t, p) == want);
+        assert(has(t, p) == !want.empty());
+        const vu32 z = zfunction(p + "#" + t);
+        i64 zc = 0;
+        for (size_t i = p.size() + 1; i < z.size(); ++i) zc += z[i] == p.size();
+        assert(zc == static_cast<i64>(want.size()));
+        assert(replace(t, p, "X") == [&] {
+            str r = t;
+            for (size_t at = 0; (at = r.find(p, at)) != str::npos; at += 1) r.replace(at, p.size(), "X");
+            return r;
+        }());
+    }
+
+    // Inputs that make a naive find quadratic: this must finish instantly
+    const str hay(2'000'000, 'a');
+    const str needle = str(20'000, 'a') + "b";
+    assert(!has(hay, needle) && findall(hay, needle).empty());
+    assert(replace(hay + "b", needle, "!") == str(2'000'000 - 20'000, 'a') + "!");
+
+    AhoCorasick ac({"he", "she", "his", "hers"});
+    assert(ac.findall("ushers") == (std::vector<std::pair<i64, u32>>{{1, 1}, {2, 0}, {2, 3}}));
+
+    println("Matching tests passed.");
+}
+
+fx testsuffixarray() {
+    assert(suffixarray("banana") == vu32({5, 3, 1, 0, 4, 2}));
+    assert(lcparray("banana", suffixarray("banana")) == vu32({1, 3, 0, 0, 2}));
+    assert(suffixarray("").empty() && SuffixArray("").distinctsubstrings() == 0);
+
+    Random rng(99);
+    for (i32 round = 0; round < 200; ++round) {
+        str s;
+        const u64 sigma = rng.rand<u64>(1, 4);
+        for (u64 len = rng.rand<u64>(0, 299); len > 0; --len) s += static_cast<char>('a' + rng.rand<u64>(0, sigma - 1));
+        const size_t n = s.size();
+        vu32 want(n);
+        for (size_t i = 0; i < n; ++i) want[i] = static_cast<u32>(i);
+        std::sort(want.begin(), want.end(), [&](u32 a, u32 b) { return s.compare(a, str::npos, s, b, str::npos) < 0; });
+        SuffixArray sa(s);
+        assert(sa.sa() == want);
+        std::set<str> subs;
+        for (size_t i = 0; i < n && n <= 120; ++i) for (size_t j = i + 1; j <= n; ++j) subs.insert(s.substr(i, j - i));
+        if (n <= 120) assert(sa.distinctsubstrings() == static_cast<i64>(subs.size()));
+        i64 best = 0;
+        for (size_t i = 0; i < n; ++i)
+            for (size_t j = 0; j < n; ++j) {
+                i64 h = 0;
+                while (i + h < n && j + h < n && s[i + h] == s[j + h]) ++h;
+                if (i != j) best = std::max(best, h);
+                if ((i * 7 + j) % 11 == 0) assert(sa.lcp(static_cast<i64>(i), static_cast<i64>(j)) == h);
+            }
+        auto [at, len] = sa.longestrepeat();
+        assert(len == best && (len == 0 || findall(s, s.substr(at, len)).size() >= 2));
+    }
+
+    // Integer alphabets go through rank compression
+    vi64 v = {1000000007, -5, 1000000007, -5, 42};
+    SuffixArray sv(v);
+    assert(sv.sa() == vu32({3, 1, 4, 2, 0}) && sv.longestrepeat() == std::make_pair(i64{2}, i64{2}));
+
+    str big;
+    for (i32 i = 0; i < 1'000'000; ++i) big += static_cast<char>('a' + (rng.rand<u64>(0, 2) == 0));
+    const vu32 bsa = suffixarray(big);
+    for (size_t k = 1; k < bsa.size(); k += 9973) assert(big.compare(bsa[k - 1], str::npos, big, bsa[k], str::npos) < 0);
+
+    println("Suffix array tests passed.");
+}
+
+fx testsuffixautomaton() {
+    SuffixAutomaton sam("abcbc");
+    assert(sam.has("bcb") && sam.has("") && !sam.has("cc") && !sam.has("abcbcx"));
+    assert(sam.occurrences("bc") == 2 && sam.occurrences("c") == 2 && sam.occurrences("x") == 0);
+    assert(sam.distinctsubstrings() == 12 && sam.longestcommon("xxcbcbx") == std::make_pair(i64{2}, i64{3}));
+    assert(SuffixAutomaton("").distinctsubstrings() == 0 && SuffixAutomaton("").size() == 1);
+
+    Random rng(2024);
+    for (i32 round = 0; round < 150; ++round) {
+        str s;
+        const u64 sigma = rng.rand<u64>(1, 4);
+        for (u64 len = rng.rand<u64>(0, 199); len > 0; --len) s += static_cast<char>('a' + rng.rand<u64>(0, sigma - 1));
+        SuffixAutomaton a(s);
+        assert(a.size() <= std::max<i64>(2 * static_cast<i64>(s.size()) - 1, 1));
+        assert(a.distinctsubstrings() == SuffixArray(s).distinctsubstrings());
+        for (i32 q = 0; q < 20; ++q) {
+            str t;
+            for (u64 len = rng.rand<u64>(1, 5); len > 0; --len) t += static_cast<char>('a' + rng.rand<u64>(0, sigma - 1));
+            assert(a.occurrences(t) == static_cast<i64>(findall(s, t).size()));
+            assert(a.has(t) == !findall(s, t).empty());
+        }
+    }
+
+    // A full byte alphabet overflows the dense budget and uses edge lists
+    str bytes;
+    for (i32 i = 0; i < 300'000; ++i) bytes += static_cast<char>(rng.rand<u64>(0, 255));
+    SuffixAutomaton b(bytes);
+    for (i32 q = 0; q < 100; ++q) {
+        const size_t at = rng.rand<u64>(0, bytes.size() - 9);
+        const strview t = strview(bytes).substr(at, rng.rand<u64>(1, 8));
+        assert(b.occurrences(t) == static_cast<i64>(findall(bytes, t).size()));
+    }
+    auto [at, len] = b.longestcommon(bytes.substr(1000, 50) + "xyz");
+    assert(at == 0 && len >= 50);
+
+    println("Suffix automaton tests passed.");
+}
+
+fx testpalindromes() {
+    assert(manacher("abaab") == vu32({1, 0, 3, 0, 1, 4, 1, 0, 1}) && manacher("").empty());
+    assert(longestpalindrome("forgeeksskeegfor") == std::make_pair(i64{3}, i64{10}));
+    assert(longestpalindrome("abc") == std::make_pair(i64{0}, i64{1}) && longestpalindrome("").second == 0);
+
+    Eertree e("eertree");
+    assert(e.distinctpalindromes() == 7 && e.totalpalindromes() == 12);
+    assert(Eertree("").distinctpalindromes() == 0 && Eertree("aaaa").distinctpalindromes() == 4);
+
+    Random rng(77);
+    auto ispal = [](strview t) { return std::equal(t.begin(), t.begin() + t.size() / 2, t.rbegin()); };
+    for (i32 round = 0; round < 150; ++round) {
+        str s;
+        const u64 sigma = rng.rand<u64>(1, 3);
+        for (u64 len = rng.rand<u64>(0, 79); len > 0; --len) s += static_cast<char>('a' + rng.rand<u64>(0, sigma - 1));
+        std::set<str> distinct;
+        i64 total = 0, best = 0;
+        for (size_t i = 0; i < s.size(); ++i)
+            for (size_t j = i + 1; j <= s.size(); ++j)
+                if (ispal(strview(s).substr(i, j - i))) {
+                    distinct.insert(s.substr(i, j - i));
+                    ++total;
+                    best = std::max<i64>(best, static_cast<i64>(j - i));
+                }
+        Eertree t(s);
+        assert(t.distinctpalindromes() == static_cast<i64>(distinct.size()) && t.totalpalindromes() == total);
+        auto [at, len] = longestpalindrome(s);
+        assert(len == best && ispal(strview(s).substr(static_cast<size_t>(at), static_cast<size_t>(len))));
+        const vu32 m = manacher(s);
+        for (size_t k = 0; k < m.size(); ++k) {
+            const size_t l = (k + 1) / 2 - m[k] / 2;
+            assert(ispal(strview(s).substr(l, m[k])));
+            assert(l == 0 || l + m[k] == s.size() || s[l - 1] != s[l + m[k]]);
+        }
+    }
+
+    str big(2'000'000, 'a');
+    for (size_t i = 0; i < big.size(); ++i) big[i] = static_cast<char>('a' + rng.rand<u64>(0, 1));
+    Eertree bt(big);
+    i64 longest = 0;
+    for (u32 v = 2; v < bt.size(); ++v) longest = std::max(longest, bt.length(v));
+    assert(bt.distinctpalindromes() <= static_cast<i64>(big.size()) && longestpalindrome(big).second == longest);
+
+    println("Palindrome tests passed.");
+}
+
+int main() {
+    println("Running String Tests...");
+    testcase();
+    testpredicates();
+    teststrip();
+    testreplace();
+    testhash();
+    testmatching();
+    testsuffixarray();
+    testsuffixautomaton();
+    testpalindromes();
+    println("All tests passed!");
+    return 0;
+}